@@ -23,109 +23,17 @@ void preprocess_node(vector<Model> &models, vector<Vehicle> &vehicles, vector<Lo
             // ensure that route is shorter than ub
             if ((*v_it).Route_scts[(*r_it)] >= ub)
                 continue;
-            // ensure that route fulfills fixed task locations of scenario and of node
-            bool feasible(true);
-            for (auto x_it = (*v_it).Route_details[(*r_it)].begin(); x_it != (*v_it).Route_details[(*r_it)].end(); ++x_it) {
-                if (find(model.Scenario_task_location_combinations[(*x_it)[0]].begin(), model.Scenario_task_location_combinations[(*x_it)[0]].end(), (*x_it)[1]) == model.Scenario_task_location_combinations[(*x_it)[0]].end()) {
-                    feasible = false;
-                    break;
-                }
-                for (int t = 0; t != number_tasks; ++t) {
-                    if (parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*x_it)[0]][t] != -1 && (int) model.Possible_task_location_combinations[(*x_it)[0]][(*x_it)[1]][t] != parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*x_it)[0]][t]) {
-                        feasible = false;
-                        break;
-                    }
-                }
-                if (!feasible)
-                    break;
-            }
-            if (!feasible) {
+            // ensure that route is not excluded from node (route enumeration)
+            if (find(parent_node.Forbidden_vehicle_routes[(*v_it).Id].begin(), parent_node.Forbidden_vehicle_routes[(*v_it).Id].end(), (*r_it)) != parent_node.Forbidden_vehicle_routes[(*v_it).Id].end())
                 continue;
-            }
-            // ensure that route fufills precedences of scenario
-            VecI start_times(number_tasks, 0); // derive start times of operations that include a certain task
-            for (auto x_it = (*v_it).Route_details[(*r_it)].begin(); x_it != (*v_it).Route_details[(*r_it)].end(); ++x_it) {
-                for (auto t = model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].begin(); t != model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].end(); ++t) {
-                    start_times[*t] = (*x_it)[2];
-                }
-            }
-            for (int t1 = 0; t1 != number_tasks; ++t1) {
-                for (int t2 = 0; t2 != number_tasks; ++t2) {
-                    if (model.Scenario_all_successors[t1][t2]) {
-                        if (start_times[t1] > start_times[t2]) {
-                            feasible = false;
-                            break;
-                        }
-                    }
-                }
-                if (!feasible)
-                    break;
-            }
-            if (!feasible) {
+            // ensure that route fulfills scenario and branching constraints of node
+            if (!route_is_feasible_in_node((*v_it).Route_details[(*r_it)], (*v_it).Route_start_times[(*r_it)], (*v_it).Route_end_times[(*r_it)], (*v_it), model, locations, parent_node, number_tasks))
                 continue;
-            }
-            // ensure that route fulfilles enforced and forbidden location times of node
-            for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-                for (auto it = parent_node.Enforced_vehicle_location_times[(*v_it).Id][(*l_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[(*v_it).Id][(*l_it).Id].end(); ++it) {
-                    if ((*v_it).Route_start_times[(*r_it)][(*l_it).Id] > (*it) || (*v_it).Route_end_times[(*r_it)][(*l_it).Id] - 1 < (*it)) {
-                        feasible = false;
-                        break;
-                    }
-                }
-                if (!feasible)
-                    break;
-                for (auto it = parent_node.Forbidden_vehicle_location_times[(*v_it).Id][(*l_it).Id].begin(); it != parent_node.Forbidden_vehicle_location_times[(*v_it).Id][(*l_it).Id].end(); ++it) {
-                    if ((*v_it).Route_start_times[(*r_it)][(*l_it).Id] <= (*it) && (*v_it).Route_end_times[(*r_it)][(*l_it).Id] - 1 >= (*it)) {
-                        feasible = false;
-                        break;
-                    }
-                }
-                if (!feasible)
-                    break;
-            }
-            if (!feasible) {
-                continue;
-            }
-            // ensure that task time corridors are fulfilled
-            for (int t = 0; t != number_tasks; ++t) {
-                if (!model.Tasks_per_model[t])
-                    continue;
-                if (start_times[t] < parent_node.Task_start_times_lower_bounds[(*v_it).Id][t] || start_times[t] > parent_node.Task_start_times_upper_bounds[(*v_it).Id][t]) {
-                    feasible = false;
-                    break;
-                }
-            }
-            if (!feasible) {
-                continue;
-            }
             (*v_it).Available_routes.push_back((*r_it));
         }
     }
     // determine available task-location combinations
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        // reset available task-location combinations
-        VecI dummy({});
-        vector<VecI> reset_ltc(number_locations, dummy);
-        (*v_it).Available_task_location_combinations = reset_ltc;
-        Model model(*(models.begin() + (*v_it).Type));
-        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-            for (size_t c_index = 0; c_index != model.Possible_task_location_combinations[(*l_it).Id].size(); ++c_index) {
-                int c((int) c_index);
-                if (find(model.Scenario_task_location_combinations[(*l_it).Id].begin(), model.Scenario_task_location_combinations[(*l_it).Id].end(), c) == model.Scenario_task_location_combinations[(*l_it).Id].end())
-                    continue;
-                bool feasible_c(true);
-                for (int t = 0; t != number_tasks; ++t) {
-                    if (parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*l_it).Id][t] != -1 && (int) model.Possible_task_location_combinations[(*l_it).Id][c_index][t] != parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*l_it).Id][t]) {
-                        feasible_c = false;
-                        break;
-                    }
-                }
-                if (!feasible_c)
-                    continue;
-                (*v_it).Available_task_location_combinations[(*l_it).Id].push_back(c);
-            }
-        }
-    }
+    determine_available_combinations(models, vehicles, locations, parent_node, number_tasks, number_locations);
     // determine available blockings
     for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
         vector<vector<VecI>> available_blockings_l;
@@ -142,6 +50,69 @@ void preprocess_node(vector<Model> &models, vector<Vehicle> &vehicles, vector<Lo
     }
 }
 //------------------------------------------------------------------------------------------------------------//
+/* Reduced-cost fixing after column generation has converged. Every solution that uses a route has an objective value
+ * of at least node_lb plus the route's reduced cost. The reduced cost of any route that contains a task-location
+ * combination is bounded from below by the minimum sct of the vehicle's model and the cheapest window of blocking costs
+ * the combination occupies at its location. Since scts are integral, the combination is removed from the subtree of
+ * the node if this bound exceeds ub - 1; pricing no longer extends it, so column generation stays exact. Single routes
+ * are not fixed: pricing could regenerate them. */
+void fix_by_reduced_cost(vector<VecI> &node_fixings, double &node_lb, int &ub, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecD> &block_cost, int &number_locations, int &horizon) {
+    double gap(ub - 1 + PRECISION - node_lb);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        Model &model(models[(*v_it).Type]);
+        double base_cost((*v_it).Sct_cost * model.Min_sct - (*v_it).Max_cost);
+        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+            if ((*l_it).Id == 0 || (*l_it).Id == number_locations - 1)
+                continue;
+            for (auto c_it = (*v_it).Available_task_location_combinations[(*l_it).Id].begin(); c_it != (*v_it).Available_task_location_combinations[(*l_it).Id].end(); ++c_it) {
+                int workload(model.Possible_task_location_combination_workloads[(*l_it).Id][(*c_it)]);
+                if (workload > horizon)
+                    continue;
+                double window_cost(0.0);
+                for (int z = 0; z != workload; ++z) {
+                    window_cost += block_cost[(*l_it).Id][z];
+                }
+                double min_window_cost(window_cost);
+                for (int z = workload; z != horizon; ++z) {
+                    window_cost += block_cost[(*l_it).Id][z] - block_cost[(*l_it).Id][z - workload];
+                    min_window_cost = min(min_window_cost, window_cost);
+                }
+                if (base_cost + min_window_cost > gap) {
+                    node_fixings.push_back({(*v_it).Id, (*l_it).Id, (*c_it)});
+                }
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Reduced cost of a route of vehicle for the vehicle's current duals and the given blocking and cut duals. */
+double route_reduced_cost(vector<VecI> &route, Vehicle &vehicle, Model &model, vector<VecD> &block_cost, VecD &cut_cost,
+        vector<vector<VecI>> &zero_half_cuts, int &number_locations) {
+    double reduced_cost(vehicle.Sct_cost * (route.back()[2] - vehicle.Arrival_time) - vehicle.Max_cost);
+    for (auto it = route.begin(); it != route.end(); ++it) {
+        if ((*it)[0] != 0 && (*it)[0] != number_locations - 1) {
+            for (int z = (*it)[2]; z != (*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]]; ++z) {
+                reduced_cost += block_cost[(*it)[0]][z];
+            }
+        }
+    }
+    for (size_t zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
+        int collide(0);
+        for (auto c = zero_half_cuts[zhc].begin(); c != zero_half_cuts[zhc].end(); ++c) {
+            for (auto it = route.begin(); it != route.end(); ++it) {
+                if ((*it)[0] == (*c)[0] && (*it)[2] <= (*c)[1] && (*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]] > (*c)[1]) {
+                    ++collide;
+                }
+            }
+        }
+        if (collide >= 2) {
+            reduced_cost += cut_cost[zhc];
+        }
+    }
+    return reduced_cost;
+}
+//------------------------------------------------------------------------------------------------------------//
 /* Check integrality of master problem solution. */
 void check_integrality(bool &node_is_integral, vector<Vehicle> &vehicles, vector<vector<GRBVar>> &use_route) {
     node_is_integral = true;
@@ -297,4 +268,89 @@ void check_integrality_of_routes_without_timings(bool &node_is_integral_without_
         }
     }
 }
-//------------------------------------------------------------------------------------------------------------//
\ No newline at end of file
+//------------------------------------------------------------------------------------------------------------//
+/* Add route to the column pool of a vehicle and register its location blockings. Returns the route index. */
+int add_route_to_pool(Vehicle &vehicle, vector<VecI> &route_details, Model &model, vector<vector<vector<VecI>>> &blockings, int &number_locations) {
+    int index((int) vehicle.All_routes.size());
+    VecI start_times(number_locations, 0);
+    VecI end_times(number_locations, 0);
+    for (auto x_it = route_details.begin(); x_it != route_details.end(); ++x_it) {
+        start_times[(*x_it)[0]] = (*x_it)[2];
+        end_times[(*x_it)[0]] = (*x_it)[2] + model.Possible_task_location_combination_workloads[(*x_it)[0]][(*x_it)[1]];
+        if ((*x_it)[0] != 0 && (*x_it)[0] != number_locations - 1) {
+            for (int z = start_times[(*x_it)[0]]; z != end_times[(*x_it)[0]]; ++z) {
+                blockings[(*x_it)[0]][z].push_back({vehicle.Id, index});
+            }
+        }
+    }
+    vehicle.All_routes.push_back(index);
+    vehicle.Route_details.push_back(route_details);
+    vehicle.Route_scts.push_back(route_details.back()[2] - vehicle.Arrival_time);
+    vehicle.Route_start_times.push_back(start_times);
+    vehicle.Route_end_times.push_back(end_times);
+    return index;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Add the routes a worker generated on its copy of the column pool (from index pool_sizes[v] on) to the shared column pool.
+ * Routes that another worker added to the shared pool in the meantime are not duplicated.
+ * Route_map maps the worker's route indices to route indices in the shared pool. */
+void merge_worker_routes(vector<VecI> &route_map, vector<Vehicle> &vehicles, vector<vector<vector<VecI>>> &blockings,
+        vector<Vehicle> &worker_vehicles, VecI &pool_sizes, vector<Model> &models, int &number_locations) {
+    route_map.clear();
+    for (auto v_it = worker_vehicles.begin(); v_it != worker_vehicles.end(); ++v_it) {
+        Vehicle &vehicle(vehicles[(*v_it).Id]);
+        VecI route_map_v((*v_it).All_routes.size(), 0);
+        for (int r = 0; r != pool_sizes[(*v_it).Id]; ++r) {
+            route_map_v[r] = r;
+        }
+        for (int r = pool_sizes[(*v_it).Id]; r != (int) (*v_it).All_routes.size(); ++r) {
+            auto it = find(vehicle.Route_details.begin() + pool_sizes[(*v_it).Id], vehicle.Route_details.end(), (*v_it).Route_details[r]);
+            if (it != vehicle.Route_details.end()) {
+                route_map_v[r] = (int) distance(vehicle.Route_details.begin(), it);
+            }
+            else {
+                route_map_v[r] = add_route_to_pool(vehicle, (*v_it).Route_details[r], models[vehicle.Type], blockings, number_locations);
+            }
+        }
+        route_map.push_back(route_map_v);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Remove the routes from index pool_sizes[v] on from the column pool of each vehicle and from the blockings. */
+void truncate_pool(vector<Vehicle> &vehicles, vector<vector<vector<VecI>>> &blockings, VecI &pool_sizes, vector<Model> &models, int &number_locations) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        int v((*v_it).Id), size(pool_sizes[v]);
+        Model &model(models[(*v_it).Type]);
+        for (int r = size; r < (int) (*v_it).All_routes.size(); ++r) {
+            for (auto x_it = (*v_it).Route_details[r].begin(); x_it != (*v_it).Route_details[r].end(); ++x_it) {
+                if ((*x_it)[0] == 0 || (*x_it)[0] == number_locations - 1)
+                    continue;
+                for (int z = (*x_it)[2]; z != (*x_it)[2] + model.Possible_task_location_combination_workloads[(*x_it)[0]][(*x_it)[1]]; ++z) {
+                    vector<VecI> &blockings_lz(blockings[(*x_it)[0]][z]);
+                    blockings_lz.erase(remove_if(blockings_lz.begin(), blockings_lz.end(), [v, size](const VecI &b) {return b[0] == v && b[1] >= size;}), blockings_lz.end());
+                }
+            }
+        }
+        if ((int) (*v_it).All_routes.size() > size) {
+            (*v_it).All_routes.resize(size);
+            (*v_it).Route_details.resize(size);
+            (*v_it).Route_scts.resize(size);
+            (*v_it).Route_start_times.resize(size);
+            (*v_it).Route_end_times.resize(size);
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Append the routes that were added to the shared column pool since the last synchronization (from index pool_sizes[v]
+ * on) to the copy of a worker, which holds exactly the first pool_sizes[v] routes of the shared pool. */
+void sync_worker_pool(vector<Vehicle> &worker_vehicles, vector<vector<vector<VecI>>> &worker_blockings, vector<Vehicle> &vehicles,
+        VecI &pool_sizes, vector<Model> &models, int &number_locations) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        Vehicle &worker_vehicle(worker_vehicles[(*v_it).Id]);
+        for (int r = pool_sizes[(*v_it).Id]; r != (int) (*v_it).All_routes.size(); ++r) {
+            add_route_to_pool(worker_vehicle, (*v_it).Route_details[r], models[(*v_it).Type], worker_blockings, number_locations);
+        }
+        pool_sizes[(*v_it).Id] = (int) (*v_it).All_routes.size();
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
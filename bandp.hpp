@@ -9,216 +9,554 @@ typedef vector<bool> VecB;
 typedef vector<double> VecD;
 typedef vector<string> VecS;
 //------------------------------------------------------------------------------------------------------------//
-/* Initialize root node for scenarios. */
-void root_node(vector<vector<VecI>> &fixed_vlt, vector<vector<VecI>> &enforced_vlz, vector<vector<VecI>> &forbidden_vlz, vector<VecI> &start_lb, vector<VecI> &start_ub,
-        vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, int &number_locations, int &number_tasks, int &horizon) {
-    // initialize fixed vlt
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        VecI dummy_vector(number_tasks, -1);
-        vector<VecI> location_task_assignments(number_locations, dummy_vector);
-        fixed_vlt.push_back(location_task_assignments);
-    }
-    // initialize enforced and forbidden vlz
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        VecI dummy({});
-        vector<VecI> enforced_v(number_locations, dummy);
-        vector<VecI> forbidden_v(number_locations, dummy);
-        enforced_vlz.push_back(enforced_v);
-        forbidden_vlz.push_back(forbidden_v);
-    }
-    // initialize lower bounds on starting times of tasks
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        VecI start_lb_v(number_tasks, 0);
-        start_lb.push_back(start_lb_v);
-    }
-    // initialize upper bounds on starting times of tasks
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        VecI start_ub_v(number_tasks, horizon);
-        start_ub.push_back(start_ub_v);
+/* Strong branching: estimate the lower bound improvement of both branches of the candidates with the highest
+ * pseudo-cost scores by solving the child nodes with a limited number of column generation iterations.
+ * Only the evaluated candidates are kept; gains holds the observed improvement of their down and up branches. */
+void strong_branching(vector<Branching_candidate> &candidates, vector<VecD> &gains, Node &parent_node, double &node_lb, int &horizon, int &ub,
+        int &ub_escape, VecI &best_sol, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times, int &number_tasks, int &number_locations,
+        Search_settings &settings, Pricing_scheduler &scheduler, Time_point &start_scenario) {
+    PROFILE_SCOPE("Strong_branching");
+    stable_sort(candidates.begin(), candidates.end(), [](const auto &c1, const auto &c2) {return c1.Score > c2.Score;});
+    if ((int) candidates.size() > settings.Strong_branching_candidates)
+        candidates.resize(max(1, settings.Strong_branching_candidates));
+    Search_settings child_settings(node_heuristic_settings(settings, settings.Strong_branching_iterations));
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        VecD gain(2, 0.0);
+        for (int direction = 0; direction != 2; ++direction) {
+            if (ub <= ub_escape || elapsed_seconds(start_scenario) >= settings.Time_limit)
+                break;
+            Node child(parent_node);
+            child.Lb = node_lb;
+            apply_branching_decision(child, {(*it).Family, direction, (*it).Var[0], (*it).Var[1], (*it).Var[2]}, vehicles, locations);
+            int child_horizon(horizon);
+            double child_lb(ub);
+            bool child_is_integral(true);
+            bool child_is_feasible(true);
+            bool child_is_complete(true);
+            vector<VecD> child_split_routes;
+            vector<vector<VecD>> child_split_usage;
+            vector<vector<VecD>> child_split_tasks;
+            vector<vector<VecD>> child_split_times;
+            vector<VecI> child_fixings;
+            solve_node(child_horizon, ub, ub_escape, best_sol, child_lb, child_is_integral, child_is_feasible, child_is_complete, child_split_routes, child_split_usage, child_split_tasks, child_split_times,
+                    child_fixings, child, models, vehicles, locations, blockings, transportation_times, number_tasks, number_locations, child_settings, scheduler, start_scenario);
+            if (child_is_complete)
+                gain[direction] = max(0.0, child_lb - node_lb);
+        }
+        (*it).Score = branching_score(gain[0], gain[1]);
+        gains.push_back(gain);
     }
 }
 //------------------------------------------------------------------------------------------------------------//
-/* Set data entries for root node. */
-void initialize_root_node(Node &root, vector<vector<VecI>> &fixed_vlt, vector<vector<VecI>> &enforced_vlz,
-        vector<vector<VecI>> &forbidden_vlz, vector<VecI> &start_lb, vector<VecI> &start_ub, vector<Model> &models, vector<Vehicle> &vehicles) {
-    root.Id = 0;
-    int max_min_sct(0);
-    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-        if (models[(*v_it).Type].Min_sct > max_min_sct) {
-            max_min_sct = models[(*v_it).Type].Min_sct;
-        }
-    }
-    root.Lb = max_min_sct;
-    root.Depth = 0;
-    root.Preference = 0;
-    root.Fixed_vehicle_location_tasks = fixed_vlt;
-    root.Enforced_vehicle_location_times = enforced_vlz;
-    root.Forbidden_vehicle_location_times = forbidden_vlz;
-    root.Task_start_times_lower_bounds = start_lb;
-    root.Task_start_times_upper_bounds = start_ub;
-}
+/* Shared state of the branch-and-price tree search. The tree is kept across the thresholds of the threshold search.
+ * All members except Settings (fixed during the search) are guarded by Mutex.
+ * The column pool (vehicles' routes and blockings) is shared as well and only grows: with more than one worker, every
+ * worker solves nodes on its own copy of the pool. After a node, it appends its new routes to the shared pool and
+ * both before and after a node, it appends the routes that were added to the shared pool since its last
+ * synchronization to its copy, so the work under Mutex is proportional to the new routes, not to the pool. */
+struct Tree_search {
+    Search_settings Settings; // settings of the search
+    mutex Mutex;
+    condition_variable Node_available; // notified when open nodes are added or the search ends
+    Open_nodes Unsolved; // open nodes
+    vector<Open_node> Retired; // leaves that cannot contain a solution below the current threshold (reopened for larger thresholds)
+    int Ub; // incumbent segment cycle time
+    VecI Best_sol; // routes of incumbent
+    int Horizon; // horizon derived from incumbent
+    int Pruned_ub; // ub at last cutoff of open nodes
+    int Id_count; // next node identifier
+    int Explored_nodes; // number of solved nodes
+    int Node_limit; // search ends once this number of nodes is explored (0: no limit)
+    int Active_workers; // number of workers currently solving a node
+    bool Stop; // search ends early: escape ub, node limit, or time limit reached
+    bool Time_limit_reached; // time limit reached
+    double Global_lb; // lowest lower bound of open nodes
+    VecI Branched_on; // number of branchings per branching family
+    Pseudo_costs Branching_costs; // pseudo-costs of branching families and vehicles
+    vector<Pricing_scheduler> Pricing; // pricing scheduler of each worker (kept across nodes and thresholds)
+    double Checkpoint_interval; // search stops for a checkpoint after this number of seconds (0: no checkpoints)
+    Time_point Last_checkpoint; // time of last checkpoint
+    bool Checkpoint_due; // search stopped to write a checkpoint
+    string Telemetry_run; // telemetry run of the workers
+    Time_point Last_memory_sample; // time of last sample of column pool and tree
+};
 //------------------------------------------------------------------------------------------------------------//
-double solve_root_node(int &scenario, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
-                     int &number_locations, int &number_tasks, vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times,
-                     VecI &best_sol, int &horizon, int &ub, clock_t &start_scenario,
-                     double &time_limit, bool &master_activity_end, int &max_routes_per_vehicle) {
-    double time_create_mp(0.0), time_solve_mp(0.0), time_identify_cuts(0.0), time_read_duals(0.0), time_solve_sp(0.0), time_add_columns(0.0), time_mip_search(0.0), time_branch(0.0), time_preprocess_node(0.0), time_postprocess_node(0.0), time_cutoff(0.0), time_sort_node(0.0), time_solve_node(0.0), time_check_integrality_and_update_best(0.0);
-    double time_sp_identify_extension(0.0), time_sp_perform_extension(0.0), time_sp_dominance_check_1(0.0), time_sp_dominance_check_2(0.0), time_add_fragment(0.0);
-    // initialize root node
-    vector<vector<VecI>> fixed_vlt;
-    vector<vector<VecI>> enforced_vlz;
-    vector<vector<VecI>> forbidden_vlz;
-    vector<VecI> start_lb, start_ub;
-    root_node(fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles, locations, number_locations, number_tasks, horizon);
-    Node root;
-    initialize_root_node(root, fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles);
-    double node_lb(ub);
-    bool node_is_integral(true);
-    bool node_is_feasible(true);
-    vector<VecD> node_split_routes;
-    vector<vector<VecD>> node_split_usage;
-    vector<vector<VecD>> node_split_tasks;
-    vector<vector<VecD>> node_split_times;
-    int no_ub_escape(0);
-    solve_node(horizon, ub, no_ub_escape, best_sol, node_lb, node_is_integral, node_is_feasible, node_split_routes, node_split_usage, node_split_tasks, node_split_times,
-               root, models, vehicles, locations, blockings, transportation_times, number_tasks, number_locations, master_activity_end, max_routes_per_vehicle, time_limit, start_scenario, time_create_mp, time_solve_mp, time_identify_cuts, time_read_duals,
-               time_solve_sp, time_add_columns, time_mip_search, time_sp_identify_extension, time_sp_perform_extension, time_sp_dominance_check_1, time_sp_dominance_check_2, time_add_fragment, time_preprocess_node, time_postprocess_node, time_check_integrality_and_update_best);
-    return node_lb;
+/* Sample memory of the shared column pool and of the leaves of the tree (caller holds tree.Mutex or the workers ended). */
+void sample_tree_memory(Tree_search &tree, vector<Vehicle> &vehicles, vector<vector<vector<VecI>>> &blockings) {
+    sample_memory(tree.Telemetry_run, "Route_pool", route_pool_bytes(vehicles));
+    sample_memory(tree.Telemetry_run, "Blockings", heap_bytes(blockings));
+    sample_memory(tree.Telemetry_run, "Open_nodes", open_nodes_bytes(tree.Unsolved, tree.Retired));
+    tree.Last_memory_sample = wall_clock();
 }
 //------------------------------------------------------------------------------------------------------------//
-/* Solve branch-and-price.*/
-void solve_branch_and_price(int &scenario, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+/* Worker of branch-and-price tree search: repeatedly select an open node, solve it, and branch. */
+void explore_tree(Tree_search &tree, int worker, Node &root, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
         int &number_locations, int &number_tasks, vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times,
-        VecI &best_sol, int &horizon, int &ub, int &ub_escape, clock_t &start_scenario,
-        double &time_limit, bool &master_activity_end, VecS &branching, int &max_routes_per_vehicle) {
-    clock_t start_bandp = clock();
-    double time_create_mp(0.0), time_solve_mp(0.0), time_identify_cuts(0.0), time_read_duals(0.0), time_solve_sp(0.0), time_add_columns(0.0), time_mip_search(0.0), time_branch(0.0), time_preprocess_node(0.0), time_postprocess_node(0.0), time_cutoff(0.0), time_sort_node(0.0), time_solve_node(0.0), time_check_integrality_and_update_best(0.0);
-    double time_sp_identify_extension(0.0), time_sp_perform_extension(0.0), time_sp_dominance_check_1(0.0), time_sp_dominance_check_2(0.0), time_add_fragment(0.0);
-    // initialize root node
-    vector<vector<VecI>> fixed_vlt;
-    vector<vector<VecI>> enforced_vlz;
-    vector<vector<VecI>> forbidden_vlz;
-    vector<VecI> start_lb, start_ub;
-    root_node(fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles, locations, number_locations, number_tasks, horizon);
-    Node root;
-    initialize_root_node(root, fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles);
-    // initialize tree
-    vector<Node> unsolved({});
-    unsolved.push_back(root);
-    int explored_nodes(0);
-    int id_count(1);
-    double global_lb(root.Lb);
-    // start branch-and-bound tree
-    VecI branched_on = {0,0,0};
+        int &ub_escape, Time_point &start_scenario) {
+    telemetry_run() = tree.Telemetry_run;
+    string memory_source(thread_memory_source());
+    Search_settings &settings(tree.Settings);
+    Pricing_scheduler &scheduler(tree.Pricing[worker]);
+    bool private_pool(settings.Threads > 1);
+    // with several workers, each worker keeps a copy of the shared column pool that is synchronized with the routes other
+    // workers added in the meantime; the shared pool only grows, so the routes up to pool_sizes agree in both
+    vector<Vehicle> worker_vehicles;
+    vector<vector<vector<VecI>>> worker_blockings;
+    VecI pool_sizes;
+    if (private_pool) {
+        lock_guard<mutex> lock(tree.Mutex);
+        worker_vehicles = vehicles;
+        worker_blockings = blockings;
+        for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+            pool_sizes.push_back((int) (*v_it).All_routes.size());
+        }
+    }
+    Time_point last_memory_sample = wall_clock();
+    vector<Vehicle> &node_vehicles(private_pool ? worker_vehicles : vehicles);
+    vector<vector<vector<VecI>>> &node_blockings(private_pool ? worker_blockings : blockings);
     while (1) {
-        // select first node from unsolved list as parent node
-        Node parent_node(unsolved[0]);
-        // erase parent node
-        unsolved.erase(unsolved.begin());
+        // select next node from open nodes as parent node
+        Open_node selected_node;
+        int ub, horizon, node_number;
+        VecI best_sol;
+        Pseudo_costs branching_costs;
+        {
+            unique_lock<mutex> lock(tree.Mutex);
+            tree.Node_available.wait(lock, [&tree]() {return tree.Stop || !tree.Unsolved.Nodes.empty() || tree.Active_workers == 0;});
+            if (tree.Stop || tree.Unsolved.Nodes.empty())
+                break;
+            PROFILE_BEGIN(select_node_timer, "Select_node");
+            pop_open_node(tree.Unsolved, selected_node);
+            PROFILE_END(select_node_timer);
+            ++tree.Active_workers;
+            node_number = tree.Explored_nodes + tree.Active_workers;
+            ub = tree.Ub;
+            horizon = tree.Horizon;
+            best_sol = tree.Best_sol;
+            if (settings.Branching_rule != "ORDER")
+                branching_costs = tree.Branching_costs;
+            if (private_pool)
+                sync_worker_pool(worker_vehicles, worker_blockings, vehicles, pool_sizes, models, number_locations);
+        }
+        // derive branching constraints of parent node
+        PROFILE_BEGIN(materialize_node_timer, "Materialize_node");
+        Node parent_node;
+        int node_ub(ub);
+        materialize_node(parent_node, selected_node, root, node_vehicles, locations, node_ub);
+        PROFILE_END(materialize_node_timer);
         // solve parent node LP relaxation using column generation
         double node_lb(ub);
         bool node_is_integral(true);
         bool node_is_feasible(true);
+        bool node_is_complete(true);
         vector<VecD> node_split_routes;
         vector<vector<VecD>> node_split_usage;
         vector<vector<VecD>> node_split_tasks;
         vector<vector<VecD>> node_split_times;
-        clock_t start_solve_node = clock();
-        solve_node(horizon, ub, ub_escape, best_sol, node_lb, node_is_integral, node_is_feasible, node_split_routes, node_split_usage, node_split_tasks, node_split_times,
-                parent_node, models, vehicles, locations, blockings, transportation_times, number_tasks, number_locations, master_activity_end, max_routes_per_vehicle, time_limit, start_scenario, time_create_mp, time_solve_mp, time_identify_cuts, time_read_duals,
-                time_solve_sp, time_add_columns, time_mip_search, time_sp_identify_extension, time_sp_perform_extension, time_sp_dominance_check_1, time_sp_dominance_check_2, time_add_fragment, time_preprocess_node, time_postprocess_node, time_check_integrality_and_update_best);
-        time_solve_node += double(clock() - start_solve_node) / CLOCKS_PER_SEC;
-        if (double(double(clock() - start_scenario) / CLOCKS_PER_SEC) >= time_limit) {
-            return;
+        vector<VecI> node_fixings;
+        PROFILE_BEGIN(solve_node_timer, "Solve_node");
+        solve_node(horizon, ub, ub_escape, best_sol, node_lb, node_is_integral, node_is_feasible, node_is_complete, node_split_routes, node_split_usage, node_split_tasks, node_split_times,
+                node_fixings, parent_node, models, node_vehicles, locations, node_blockings, transportation_times, number_tasks, number_locations, settings, scheduler, start_scenario);
+        PROFILE_END(solve_node_timer);
+        sample_memory(memory_source, "Node", node_bytes(parent_node));
+        if (private_pool && elapsed_seconds(last_memory_sample) >= MEMORY_SAMPLE_INTERVAL) {
+            last_memory_sample = wall_clock();
+            sample_memory(memory_source, "Route_pool", route_pool_bytes(worker_vehicles));
+            sample_memory(memory_source, "Blockings", heap_bytes(worker_blockings));
         }
-        if (ub <= ub_escape) {
-            break;
-        }
-        if (node_is_feasible && !node_is_integral && ub - node_lb > 1 - PRECISION) {
-            // start branching
-            clock_t start_branch = clock();
-            vector<Vehicle> sorted_vehicles(vehicles);
-            sort(sorted_vehicles.begin(), sorted_vehicles.end(), [](const auto &v1, const auto &v2) {return v1.Id < v2.Id;});
-            sort(sorted_vehicles.begin(), sorted_vehicles.end(), [](const auto &v1, const auto &v2) {return v1.Current_sct > v2.Current_sct;});
-            bool found(false);
-            for (auto v_it = sorted_vehicles.begin(); v_it != sorted_vehicles.end(); ++v_it) {
-                for (auto it = branching.begin(); it != branching.end(); ++it) {
-                    if (*it == "ASSIGN") {
-                        branch_on_assign(found, unsolved, branched_on, id_count, vehicles, locations, number_locations,
-                                         number_tasks, parent_node, node_split_tasks, node_lb, (*v_it).Id);
-                    } else if (*it == "USAGE") {
-                        branch_on_usage(found, unsolved, branched_on, id_count, vehicles, locations, number_locations,
-                                        horizon, parent_node, node_split_usage, node_lb, (*v_it).Id);
-                    } else if (*it == "TIME") {
-                        branch_on_time(found, unsolved, branched_on, id_count, models, vehicles, locations,
-                                       number_locations, number_tasks, horizon, parent_node, node_split_times, node_lb,
-                                       (*v_it).Id);
-
-                    }
-                    if (found)
-                        break;
+        // select branching candidate
+        vector<Branching_candidate> candidates;
+        vector<VecD> strong_gains;
+        if (node_is_feasible && !node_is_integral && ub > ub_escape && ub - node_lb > 1 - PRECISION) {
+            PROFILE_SCOPE("Branch");
+            find_branching_candidates(candidates, node_vehicles, locations, number_locations, number_tasks, horizon, settings.Branching,
+                                      node_split_usage, node_split_tasks, node_split_times);
+            if (settings.Branching_rule != "ORDER" && candidates.size() > 1) {
+                score_branching_candidates(candidates, branching_costs);
+                if (settings.Branching_rule == "STRONG") {
+                    strong_branching(candidates, strong_gains, parent_node, node_lb, horizon, ub, ub_escape, best_sol, models, node_vehicles, locations,
+                                     node_blockings, transportation_times, number_tasks, number_locations, settings, scheduler, start_scenario);
                 }
-                if (found)
-                    break;
+                int best(best_branching_candidate(candidates));
+                swap(candidates[0], candidates[best]);
+                if (!strong_gains.empty())
+                    swap(strong_gains[0], strong_gains[best]);
             }
-            time_branch += double(clock() - start_branch) / CLOCKS_PER_SEC;
-        }
-        // cut off dominated nodes in B&B tree
-        clock_t start_cutoff = clock();
-        auto it = unsolved.begin();
-        while (it != unsolved.end()) {
-            if (ub - (*it).Lb < 1 - PRECISION)
-                unsolved.erase(it);
-            else
-                ++it;
-        }
-        time_cutoff += double(clock() - start_cutoff) / CLOCKS_PER_SEC;
-        if (!unsolved.empty()) {
-            // sort unsolved nodes
-            clock_t start_sort_node = clock();
-            sort(unsolved.begin(), unsolved.end(), [](const auto &n1, const auto &n2) {return n1.Id < n2.Id;});
-            sort(unsolved.begin(), unsolved.end(), [](const auto &n1, const auto &n2) {return n1.Lb < n2.Lb;});
-            global_lb = unsolved[0].Lb;
-            sort(unsolved.begin(), unsolved.end(), [](const auto &n1, const auto &n2) {return n1.Preference > n2.Preference;});
-            sort(unsolved.begin(), unsolved.end(), [](const auto &n1, const auto &n2) {return n1.Depth > n2.Depth;});
-            time_sort_node += double(clock() - start_sort_node) / CLOCKS_PER_SEC;
-            ++explored_nodes;
-            cout << "EXPLORED: " << explored_nodes << " OPEN: " << unsolved.size() << " LB: " << global_lb << " UB: " << ub << " GAP: " << (ub - global_lb) / ub * 100 << "%" << endl;
         }
-        else {
-            global_lb = ub;
-            ++explored_nodes;
-            cout << "EXPLORED: " << explored_nodes << " OPEN: " << unsolved.size() << " LB: " << global_lb << " UB: " << ub << " GAP: " << (ub - global_lb) / ub * 100 << "%" << endl;
-            break;
+        // primal heuristic: diving from node LP
+        if (settings.Diving_frequency > 0 && (node_number - 1) % settings.Diving_frequency == 0 && node_is_feasible && !node_is_integral && ub > ub_escape
+            && ub - node_lb > 1 - PRECISION && elapsed_seconds(start_scenario) < settings.Time_limit) {
+            PROFILE_SCOPE("Diving");
+            dive(ub, ub_escape, best_sol, parent_node, node_lb, node_split_routes, models, node_vehicles, locations, node_blockings, transportation_times,
+                 number_tasks, number_locations, settings, scheduler, start_scenario);
+        }
+        // primal heuristic: restricted master MIP over column pool
+        if (settings.Mip_search_frequency > 0 && (node_number - 1) % settings.Mip_search_frequency == 0 && ub > ub_escape
+            && elapsed_seconds(start_scenario) < settings.Time_limit) {
+            PROFILE_SCOPE("Mip_search");
+            solve_restricted_master_mip(ub, best_sol, root, models, node_vehicles, locations, node_blockings, number_tasks, number_locations,
+                                        settings.Master_activity_end, settings.Mip_search_time_limit, settings.Time_limit, start_scenario);
+        }
+        {
+            lock_guard<mutex> lock(tree.Mutex);
+            --tree.Active_workers;
+            // publish new columns and incumbent; the worker's new routes are replaced by their copies in the shared pool
+            if (private_pool) {
+                vector<VecI> route_map;
+                merge_worker_routes(route_map, vehicles, blockings, worker_vehicles, pool_sizes, models, number_locations);
+                if (ub < tree.Ub) {
+                    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+                        best_sol[(*v_it).Id] = route_map[(*v_it).Id][best_sol[(*v_it).Id]];
+                    }
+                }
+                truncate_pool(worker_vehicles, worker_blockings, pool_sizes, models, number_locations);
+                sync_worker_pool(worker_vehicles, worker_blockings, vehicles, pool_sizes, models, number_locations);
+            }
+            if (ub < tree.Ub) {
+                tree.Ub = ub;
+                tree.Best_sol = best_sol;
+                tree.Horizon = vehicles.back().Arrival_time + ub;
+            }
+            if (elapsed_seconds(start_scenario) >= settings.Time_limit || !node_is_complete) {
+                tree.Time_limit_reached = true;
+                tree.Stop = true;
+            }
+            if (tree.Ub <= ub_escape) {
+                tree.Stop = true;
+            }
+            if (tree.Checkpoint_interval > 0 && tree.Node_limit == 0 && elapsed_seconds(tree.Last_checkpoint) >= tree.Checkpoint_interval) {
+                tree.Checkpoint_due = true;
+                tree.Stop = true;
+            }
+            bool node_is_solved(node_is_feasible && node_is_integral);
+            if (tree.Stop) {
+                // keep node in tree for the next threshold (a node interrupted by the time limit is never retired)
+                if (!node_is_solved || !node_is_complete)
+                    push_open_node(tree.Unsolved, selected_node);
+                tree.Node_available.notify_all();
+                break;
+            }
+            // update pseudo-costs with the bound improvement of the solved node and of the strong branching children
+            update_pseudo_costs(tree.Branching_costs, selected_node.Decision.Family, selected_node.Decision.Vehicle, selected_node.Decision.Direction,
+                                min(node_lb, (double) node_ub) - selected_node.Lb, selected_node.Fractionality);
+            for (size_t i = 0; i != strong_gains.size(); ++i) {
+                update_pseudo_costs(tree.Branching_costs, candidates[i].Family, candidates[i].Var[0], 0, strong_gains[i][0], candidates[i].Down_fractionality);
+                update_pseudo_costs(tree.Branching_costs, candidates[i].Family, candidates[i].Var[0], 1, strong_gains[i][1], candidates[i].Up_fractionality);
+            }
+            if (!candidates.empty() && tree.Ub - node_lb > 1 - PRECISION) {
+                // start branching
+                PROFILE_SCOPE("Branch");
+                selected_node.Fixings = node_fixings;
+                selected_node.Fixings_ub = ub;
+                shared_ptr<const Open_node> parent_open_node(make_shared<Open_node>(move(selected_node)));
+                create_branches(tree.Unsolved, tree.Branched_on, tree.Id_count, parent_open_node, candidates[0], node_lb);
+            }
+            else if (!node_is_solved && (!node_is_feasible || tree.Ub - node_lb <= 1 - PRECISION)) {
+                // retire leaf: the node's lower bound only holds for solutions below node_ub since routes are restricted to node_ub
+                selected_node.Lb = max(selected_node.Lb, min(node_lb, (double) node_ub));
+                selected_node.Fixings = node_fixings;
+                selected_node.Fixings_ub = ub;
+                tree.Retired.push_back(move(selected_node));
+            }
+            // cut off dominated nodes in B&B tree (children are only created if they cannot be cut off, i.e., only a new ub cuts off nodes)
+            PROFILE_BEGIN(cutoff_timer, "Cutoff");
+            if (tree.Ub != tree.Pruned_ub) {
+                prune_open_nodes(tree.Unsolved, tree.Ub, tree.Retired);
+                tree.Pruned_ub = tree.Ub;
+            }
+            PROFILE_END(cutoff_timer);
+            ++tree.Explored_nodes;
+            if (tree.Node_limit > 0 && tree.Explored_nodes >= tree.Node_limit)
+                tree.Stop = true;
+            if (!tree.Unsolved.Nodes.empty()) {
+                tree.Global_lb = open_nodes_lower_bound(tree.Unsolved);
+            }
+            else {
+                tree.Global_lb = tree.Ub;
+            }
+            cout << "EXPLORED: " << tree.Explored_nodes << " OPEN: " << tree.Unsolved.Nodes.size() << " LB: " << tree.Global_lb << " UB: " << tree.Ub << " GAP: " << (tree.Ub - tree.Global_lb) / tree.Ub * 100 << "%" << endl;
+            if (elapsed_seconds(tree.Last_memory_sample) >= MEMORY_SAMPLE_INTERVAL)
+                sample_tree_memory(tree, vehicles, blockings);
+            tree.Node_available.notify_all();
         }
     }
-    double bandp_time = double(clock() - start_bandp) / CLOCKS_PER_SEC;
+    release_memory_samples(memory_source);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Print profile of branch-and-price phases and branching statistics. */
+void print_bandp_times(Tree_search &tree) {
+    print_profile();
+    // times of next report start from zero
+    reset_profile();
     cout << "-------------------------------------------------------------" << endl;
-    cout << "Optimal solution with SCT " << ub << " found after evauating " << explored_nodes << " nodes in " << bandp_time << " seconds." << endl;
+    cout << "Branched on: " << tree.Branched_on[0] << " " << tree.Branched_on[1] << " " << tree.Branched_on[2] << endl;
     cout << "-------------------------------------------------------------" << endl;
-    cout << "Time to solve nodes: " << time_solve_node << " seconds." << endl;
-    cout << "Time to create branches: " << time_branch << " seconds." << endl;
-    cout << "Time to cutoff nodes: " << time_cutoff << " seconds." << endl;
-    cout << "Time to sort nodes: " << time_sort_node << " seconds." << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Lowest lower bound of all open and retired leaves of the tree, at most ub. */
+double frontier_lower_bound(Tree_search &tree, int &ub) {
+    double lb(ub);
+    for (auto it = tree.Unsolved.Nodes.begin(); it != tree.Unsolved.Nodes.end(); ++it) {
+        lb = min(lb, (*it).second.Lb);
+    }
+    for (auto it = tree.Retired.begin(); it != tree.Retired.end(); ++it) {
+        lb = min(lb, (*it).Lb);
+    }
+    return lb;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Solve branch-and-price for threshold ub, i.e., search the leaves of the tree for a solution with sct < ub.
+ * Leaves that cannot contain such a solution are retired, all others are reopened. */
+void solve_branch_and_price(Tree_search &tree, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        int &number_locations, int &number_tasks, vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times,
+        VecI &best_sol, int &horizon, int &ub, int &ub_escape, int &node_limit, Time_point &start_scenario) {
+    Time_point start_bandp = wall_clock();
+    // initialize root node for horizon of threshold
+    vector<vector<VecI>> fixed_vlt;
+    vector<vector<VecI>> enforced_vlz;
+    vector<vector<VecI>> forbidden_vlz;
+    vector<VecI> start_lb, start_ub;
+    root_node(fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles, locations, number_locations, number_tasks, horizon);
+    Node root;
+    initialize_root_node(root, fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles);
+    // reopen leaves of tree that may contain a solution below threshold
+    vector<Open_node> leaves;
+    for (auto it = tree.Unsolved.Nodes.begin(); it != tree.Unsolved.Nodes.end(); ++it) {
+        leaves.push_back(move((*it).second));
+    }
+    for (auto it = tree.Retired.begin(); it != tree.Retired.end(); ++it) {
+        leaves.push_back(move(*it));
+    }
+    tree.Retired.clear();
+    initialize_open_nodes(tree.Unsolved, tree.Settings.Node_selection, tree.Settings.Best_bound_frequency);
+    for (auto it = leaves.begin(); it != leaves.end(); ++it) {
+        if (ub - (*it).Lb < 1 - PRECISION) {
+            tree.Retired.push_back(move(*it));
+        }
+        else {
+            push_open_node(tree.Unsolved, *it);
+        }
+    }
+    tree.Ub = ub;
+    tree.Best_sol = best_sol;
+    tree.Horizon = horizon;
+    tree.Pruned_ub = ub;
+    tree.Active_workers = 0;
+    tree.Stop = false;
+    tree.Time_limit_reached = false;
+    tree.Checkpoint_due = false;
+    tree.Telemetry_run = telemetry_run();
+    tree.Node_limit = node_limit > 0 ? tree.Explored_nodes + node_limit : 0;
+    tree.Last_memory_sample = wall_clock();
+    int explored_nodes(tree.Explored_nodes);
+    // start branch-and-bound tree
+    if (tree.Settings.Threads > 1) {
+        vector<thread> workers;
+        for (int w = 0; w != tree.Settings.Threads; ++w) {
+            workers.push_back(thread(explore_tree, ref(tree), w, ref(root), ref(models), ref(vehicles), ref(locations),
+                                     ref(number_locations), ref(number_tasks), ref(blockings), ref(transportation_times), ref(ub_escape),
+                                     ref(start_scenario)));
+        }
+        for (auto it = workers.begin(); it != workers.end(); ++it) {
+            (*it).join();
+        }
+    }
+    else {
+        int worker(0);
+        explore_tree(tree, worker, root, models, vehicles, locations, number_locations, number_tasks, blockings, transportation_times,
+                     ub_escape, start_scenario);
+    }
+    sample_tree_memory(tree, vehicles, blockings);
+    ub = tree.Ub;
+    best_sol = tree.Best_sol;
+    horizon = tree.Horizon;
+    if (tree.Time_limit_reached || tree.Checkpoint_due || node_limit > 0) {
+        return;
+    }
+    double bandp_time = elapsed_seconds(start_bandp);
     cout << "-------------------------------------------------------------" << endl;
-    cout << "Time to preprocess nodes: " << time_preprocess_node << " seconds." << endl;
-    cout << "Time to create master problem: " << time_create_mp << " seconds." << endl;
-    cout << "Time to solve master problem: " << time_solve_mp << " seconds." << endl;
-    cout << "Time to identify cuts: " << time_identify_cuts << " seconds." << endl;
-    cout << "Time to check integrality and update best: " << time_check_integrality_and_update_best << " seconds." << endl;
-    cout << "Time to read dual values: " << time_read_duals << " seconds." << endl;
-    cout << "Time to solve subproblems: " << time_solve_sp << " seconds." << endl;
-    cout << "Time to add columns: " << time_add_columns << " seconds." << endl;
-    cout << "Time to postprocess nodes: " << time_postprocess_node << " seconds." << endl;
-    cout << "Time for MIP search: " << time_mip_search << " seconds." << endl;
+    cout << "Optimal solution with SCT " << ub << " found after evauating " << tree.Explored_nodes - explored_nodes << " nodes in " << bandp_time << " seconds." << endl;
     cout << "-------------------------------------------------------------" << endl;
-    cout << "Time to identify candidates: " << time_sp_identify_extension << " seconds." << endl;
-    cout << "Time for route extension: " << time_sp_perform_extension << " seconds." << endl;
-    cout << "Time for dominance 1: " << time_sp_dominance_check_1 << " seconds." << endl;
-    cout << "Time for dominance 2: " << time_sp_dominance_check_2 << " seconds." << endl;
-    cout << "Time to add fragments: " << time_add_fragment << " seconds." << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write checkpoint of threshold search interrupted during threshold number iterations. */
+void checkpoint_threshold_search(string &checkpoint_file, uint64_t &key, Tree_search &tree, vector<Vehicle> &vehicles, VecI &best_sol, int &horizon, int &ub,
+        int &lb, int &proven_lb, int &step, bool &solution_found, int &iterations, Time_point &start_scenario) {
+    Search_checkpoint checkpoint;
+    checkpoint.Key = key;
+    checkpoint.Finished = false;
+    checkpoint.Ub = ub;
+    checkpoint.Best_sol = best_sol;
+    checkpoint.Horizon = horizon;
+    checkpoint.Lb = lb;
+    checkpoint.Proven_lb = proven_lb;
+    checkpoint.Step = step;
+    checkpoint.Solution_found = solution_found;
+    checkpoint.Iterations = iterations - 1;
+    checkpoint.Elapsed = elapsed_seconds(start_scenario);
+    checkpoint.Id_count = tree.Id_count;
+    checkpoint.Explored_nodes = tree.Explored_nodes;
+    checkpoint.Branched_on = tree.Branched_on;
+    checkpoint.Branching_costs = tree.Branching_costs;
+    for (auto it = tree.Unsolved.Nodes.begin(); it != tree.Unsolved.Nodes.end(); ++it) {
+        checkpoint.Leaves.push_back((*it).second);
+    }
+    checkpoint.Leaves.insert(checkpoint.Leaves.end(), tree.Retired.begin(), tree.Retired.end());
+    write_checkpoint(checkpoint_file, checkpoint, vehicles);
+    tree.Last_checkpoint = wall_clock();
+    cout << "Checkpoint: " << checkpoint.Leaves.size() << " leaves after " << tree.Explored_nodes << " nodes written to " << checkpoint_file << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Threshold search: determine the minimum sct by solving branch-and-price for thresholds between the lower bound and
+ * the best known solution ub. A threshold without solution raises the lower bound, a solution below the threshold
+ * lowers ub. The tree (open and retired leaves), the pseudo-costs, and the column pool are kept across thresholds.
+ * Thresholds are chosen by INCREMENT (lower bound + 1), GALLOP (steps above the lower bound that double after each
+ * threshold without solution; bisection once a solution is found), or BISECTION.
+ * Without root bound, a single threshold equal to ub is solved.
+ * Bounds are exchanged with the other scenarios of the instance before each threshold (see Scenario_bounds).
+ * With a checkpoint interval, the search is interrupted periodically and at the time limit to write a checkpoint; with
+ * resume, the search continues from the checkpoint (its elapsed time counts towards the time limit). */
+void solve_threshold_search(vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        int &number_locations, int &number_tasks, vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times,
+        VecI &best_sol, int &horizon, int &ub, int &iterations, Time_point &start_scenario, Search_settings &settings,
+        Scenario_bounds &bounds, int &scenario, uint64_t &key) {
+    Time_point start_search = wall_clock();
+    // profile only this search (searches stopped by the time limit are not reported)
+    reset_profile();
+    // initialize tree with root node
+    Tree_search tree;
+    tree.Settings = settings;
+    tree.Id_count = 1;
+    tree.Explored_nodes = 0;
+    tree.Branched_on = {0,0,0};
+    initialize_pseudo_costs(tree.Branching_costs, (int) vehicles.size());
+    tree.Checkpoint_interval = settings.Checkpoint_interval;
+    tree.Last_checkpoint = wall_clock();
+    tree.Checkpoint_due = false;
+    tree.Pricing.resize(max(1, settings.Threads));
+    for (int w = 0; w != (int) tree.Pricing.size(); ++w) {
+        initialize_pricing_scheduler(tree.Pricing[w], (int) vehicles.size(), settings.Pricing_seed + w, settings.Pricing_vehicles, settings.Async_pricing,
+                                     settings.Column_selection, settings.Column_transfer, settings.Pricing_engine, settings.Pulse_labels);
+    }
+    Open_node root_open_node;
+    root_open_node.Id = 0;
+    root_open_node.Lb = 0;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        root_open_node.Lb = max(root_open_node.Lb, (double) models[(*v_it).Type].Min_sct);
+    }
+    root_open_node.Depth = 0;
+    root_open_node.Preference = 0;
+    root_open_node.Decision = {-1, 0, 0, 0, 0};
+    root_open_node.Fractionality = 0.0;
+    root_open_node.Fixings_ub = 0;
+    initialize_open_nodes(tree.Unsolved, settings.Node_selection, settings.Best_bound_frequency);
+    push_open_node(tree.Unsolved, root_open_node);
+    tree.Global_lb = root_open_node.Lb;
+    int no_node_limit(0);
+    int proven_lb(0); // lb is only proven with root bound or after a failed threshold
+    int step(1);
+    bool solution_found(false);
+    iterations = 0;
+    // resume from checkpoint: restore tree, search state, and column pool
+    Search_checkpoint checkpoint;
+    bool resumed(settings.Resume && read_checkpoint(settings.Checkpoint_file, key, checkpoint, models, vehicles, locations, transportation_times, blockings, number_locations, number_tasks) && !checkpoint.Finished);
+    if (resumed) {
+        ub = checkpoint.Ub;
+        best_sol = checkpoint.Best_sol;
+        horizon = checkpoint.Horizon;
+        proven_lb = checkpoint.Proven_lb;
+        step = checkpoint.Step;
+        solution_found = checkpoint.Solution_found;
+        iterations = checkpoint.Iterations;
+        start_scenario -= chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(checkpoint.Elapsed));
+        tree.Id_count = checkpoint.Id_count;
+        tree.Explored_nodes = checkpoint.Explored_nodes;
+        tree.Branched_on = checkpoint.Branched_on;
+        tree.Branching_costs = checkpoint.Branching_costs;
+        tree.Unsolved.Nodes.clear();
+        tree.Retired = move(checkpoint.Leaves);
+        tree.Global_lb = frontier_lower_bound(tree, ub);
+        cout << "Resume from checkpoint: " << tree.Retired.size() << " leaves, " << tree.Explored_nodes << " nodes, " << checkpoint.Elapsed << " seconds" << endl;
+    }
+    fetch_scenario_bounds(bounds, scenario, ub, best_sol, horizon, proven_lb, models, vehicles, blockings, number_locations);
+    int lb(resumed ? checkpoint.Lb : ub - 1);
+    if (settings.Use_root_bound && !resumed) {
+        // solve root node with best known solution as threshold to derive lower bound
+        int threshold(ub);
+        int no_ub_escape(0);
+        int root_node_limit(1);
+        VecI routes(best_sol);
+        int threshold_horizon(horizon);
+        solve_branch_and_price(tree, models, vehicles, locations, number_locations, number_tasks, blockings, transportation_times, routes, threshold_horizon,
+                               threshold, no_ub_escape, root_node_limit, start_scenario);
+        if (threshold < ub) {
+            ub = threshold;
+            best_sol = routes;
+            horizon = threshold_horizon;
+        }
+        if (tree.Time_limit_reached)
+            return;
+        lb = (int) ceil(frontier_lower_bound(tree, ub) - PRECISION);
+        cout << "Root node LB: " << lb << " UB: " << ub << endl;
+        proven_lb = max(proven_lb, lb);
+        publish_lower_bound(bounds, scenario, proven_lb);
+    }
+    lb = max(lb, proven_lb);
+    while (lb < ub) {
+        // bounds of other scenarios solved concurrently
+        int shared_lb(proven_lb);
+        fetch_scenario_bounds(bounds, scenario, ub, best_sol, horizon, shared_lb, models, vehicles, blockings, number_locations);
+        if (shared_lb > proven_lb) {
+            proven_lb = shared_lb;
+            lb = max(lb, proven_lb);
+            if (lb >= ub)
+                break;
+        }
+        int threshold(lb + 1);
+        if (settings.Threshold_search == "BISECTION" || (settings.Threshold_search == "GALLOP" && solution_found)) {
+            threshold = (lb + ub + 1) / 2;
+        }
+        else if (settings.Threshold_search == "GALLOP") {
+            threshold = min(ub, lb + step);
+        }
+        ++iterations;
+        cout << "Try threshold < " << threshold << endl;
+        int current_threshold(threshold);
+        int ub_escape(threshold - 1);
+        VecI routes(best_sol);
+        int threshold_horizon(vehicles.back().Arrival_time + threshold);
+        while (1) {
+            solve_branch_and_price(tree, models, vehicles, locations, number_locations, number_tasks, blockings, transportation_times, routes, threshold_horizon,
+                                   current_threshold, ub_escape, no_node_limit, start_scenario);
+            // interrupted threshold: write checkpoint and continue (unless the time limit is reached)
+            if (current_threshold == threshold && (tree.Checkpoint_due || tree.Time_limit_reached) && settings.Checkpoint_interval > 0)
+                checkpoint_threshold_search(settings.Checkpoint_file, key, tree, vehicles, best_sol, horizon, ub, lb, proven_lb, step, solution_found, iterations, start_scenario);
+            if (current_threshold < threshold || !tree.Checkpoint_due || tree.Time_limit_reached)
+                break;
+        }
+        if (current_threshold < threshold) {
+            ub = current_threshold;
+            best_sol = routes;
+            horizon = threshold_horizon;
+            solution_found = true;
+            publish_upper_bound(bounds, scenario, ub, best_sol, vehicles);
+        }
+        else if (!tree.Time_limit_reached) {
+            lb = max(lb, threshold);
+            step *= 2;
+            proven_lb = max(proven_lb, threshold);
+            publish_lower_bound(bounds, scenario, proven_lb);
+        }
+        if (tree.Time_limit_reached)
+            return;
+        if (settings.Use_root_bound)
+            lb = max(lb, (int) ceil(frontier_lower_bound(tree, ub) - PRECISION));
+    }
     cout << "-------------------------------------------------------------" << endl;
-    cout << "Branched on: " << branched_on[0] << " " << branched_on[1] << " " << branched_on[2] << endl;
+    cout << "Threshold search: SCT " << ub << " after " << iterations << " thresholds, " << tree.Explored_nodes << " nodes, and " << elapsed_seconds(start_search) << " seconds." << endl;
     cout << "-------------------------------------------------------------" << endl;
+    print_bandp_times(tree);
+    release_memory_samples(telemetry_run());
 }
-//------------------------------------------------------------------------------------------------------------//
\ No newline at end of file
+//------------------------------------------------------------------------------------------------------------//
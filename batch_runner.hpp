@@ -0,0 +1,175 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Batch runner: solve a list of instances with several local worker processes.
+ * Each worker process solves one instance at a time (the executable is called with --instance) and is restricted to
+ * its own cores and a memory cap. The solution files of the instances are merged into one summary table. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Batch_options {
+    VecS Instances; // instances to be solved
+    int Vehicles; // number of vehicles read from each instance
+    int Workers; // number of worker processes (0: solve instances in this process)
+    int Threads; // worker threads of branch-and-price per process
+    int Cores; // number of cores per worker process (0: no restriction)
+    int First_core; // first core of this process (-1: no restriction)
+    double Memory_limit; // memory cap per process in GB (0: no limit)
+};
+//------------------------------------------------------------------------------------------------------------//
+void print_usage(string executable) {
+    cout << "Usage: " << executable << " [--instance NAME]... [--vehicles N] [--batch WORKERS] [--threads N] [--cores N] [--first-core N] [--memory-limit GB]" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Read command line arguments into options. Returns false for unknown or incomplete arguments. */
+bool parse_arguments(int argc, char *argv[], Batch_options &options) {
+    VecS instances;
+    for (int i = 1; i < argc; ++i) {
+        string argument(argv[i]);
+        if (i + 1 == argc) {
+            cout << "WARNING: Missing value of argument " << argument << endl;
+            return false;
+        }
+        string value(argv[++i]);
+        if (argument == "--instance")
+            instances.push_back(value);
+        else if (argument == "--vehicles")
+            options.Vehicles = stoi(value);
+        else if (argument == "--batch")
+            options.Workers = stoi(value);
+        else if (argument == "--threads")
+            options.Threads = stoi(value);
+        else if (argument == "--cores")
+            options.Cores = stoi(value);
+        else if (argument == "--first-core")
+            options.First_core = stoi(value);
+        else if (argument == "--memory-limit")
+            options.Memory_limit = stod(value);
+        else {
+            cout << "WARNING: Unknown argument " << argument << endl;
+            return false;
+        }
+    }
+    if (!instances.empty())
+        options.Instances = instances;
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Restrict address space of this process (only on Linux). */
+void limit_memory(double &memory_limit) {
+    if (memory_limit <= 0)
+        return;
+#ifdef __linux__
+    rlimit limit;
+    limit.rlim_cur = (rlim_t) (memory_limit * 1024 * 1024 * 1024);
+    limit.rlim_max = limit.rlim_cur;
+    if (setrlimit(RLIMIT_AS, &limit) != 0)
+        cout << "WARNING: Memory limit could not be set!" << endl;
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Bind this process to the cores first_core, ..., first_core + cores - 1 (only on Linux). */
+void bind_to_cores(int &first_core, int &cores) {
+    if (first_core < 0 || cores <= 0)
+        return;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c = first_core; c != first_core + cores; ++c) {
+        CPU_SET(c, &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        cout << "WARNING: Process could not be bound to cores!" << endl;
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Exit status of a worker process as returned by system() (-1 if the process did not exit normally). */
+int exit_status(int status) {
+#ifdef __linux__
+    return (status != -1 && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+#else
+    return status;
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Solve instances with options.Workers worker processes. Worker w uses the cores w * Cores, ..., (w + 1) * Cores - 1;
+ * the output of each instance is written to Results/Logs. A solution file of a previous run is removed before the
+ * instance is launched. Returns the exit status of the worker process per instance. */
+VecI run_batch(string executable, Batch_options &options) {
+    VecI statuses(options.Instances.size(), -1);
+    mutex instances_mutex;
+    size_t next_instance(0);
+    vector<thread> workers;
+    for (int w = 0; w != options.Workers; ++w) {
+        workers.push_back(thread([&, w]() {
+            while (1) {
+                string instance;
+                size_t i;
+                {
+                    lock_guard<mutex> lock(instances_mutex);
+                    if (next_instance == options.Instances.size())
+                        return;
+                    i = next_instance;
+                    instance = options.Instances[i];
+                    ++next_instance;
+                }
+                remove(("Results/Solutions/solution_" + instance + ".csv").c_str());
+                string command(executable + " --instance " + instance + " --vehicles " + to_string(options.Vehicles) + " --threads " + to_string(options.Threads)
+                               + " --memory-limit " + to_string(options.Memory_limit));
+                if (options.Cores > 0)
+                    command += " --cores " + to_string(options.Cores) + " --first-core " + to_string(w * options.Cores);
+                command += " > Results/Logs/" + instance + ".log 2>&1";
+                int status(exit_status(system(command.c_str())));
+                lock_guard<mutex> lock(instances_mutex);
+                statuses[i] = status;
+                cout << "Worker " << w << ": instance " << instance << " finished with status " << status << endl;
+            }
+        }));
+    }
+    for (auto it = workers.begin(); it != workers.end(); ++it) {
+        (*it).join();
+    }
+    return statuses;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Merge solution files of instances (written by write_solutions_to_csv) into one table with one row per instance:
+ * sct, time, and threshold iterations per scenario, and the exit status of the worker process of the instance. */
+void write_summary_to_csv(VecS &instances, VecI &statuses, string filename) {
+    VecS scenarios({"NF", "OF", "RF", "FF"});
+    std::ofstream summary;
+    summary.open(filename);
+    summary << "instance";
+    VecS rows({"sct", "time", "iterations"});
+    for (auto r_it = rows.begin(); r_it != rows.end(); ++r_it) {
+        for (auto s_it = scenarios.begin(); s_it != scenarios.end(); ++s_it) {
+            summary << "," << (*r_it) << "_" << (*s_it);
+        }
+    }
+    summary << ",status\n";
+    for (size_t i = 0; i != instances.size(); ++i) {
+        summary << instances[i];
+        std::ifstream solution("Results/Solutions/solution_" + instances[i] + ".csv");
+        int values(0);
+        string line;
+        while (getline(solution, line)) {
+            VecS entries;
+            boost::split(entries, line, boost::is_any_of(","));
+            for (auto e_it = entries.begin(); e_it != entries.end(); ++e_it) {
+                if ((*e_it).empty())
+                    continue;
+                summary << "," << (*e_it);
+                ++values;
+            }
+        }
+        for (; values < (int) (rows.size() * scenarios.size()); ++values) {
+            summary << ",";
+        }
+        summary << "," << statuses[i] << "\n";
+    }
+    summary.close();
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------------------------------------//
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <boost/algorithm/string.hpp>
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <random>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#if defined(PROFILING) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(PROFILING) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+#include <math.h>
+#include "timer.hpp"
+#include "profiler.hpp"
+#include "instance_list.hpp"
+#include "instance_reader.hpp"
+#include "preprocessing.hpp"
+#include "preprocess_scenario.hpp"
+#include "initial_solution.hpp"
+#include "route_finder.hpp"
+#include "synthetic_duals.hpp"
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* Benchmark of preprocessing and pricing without Gurobi. For every instance, preprocess and
+ * initialize_models_for_scenario are timed, and find_new_routes is called for every vehicle of every scenario on the
+ * root node with synthetic duals (or with duals read from a file). Reported are the time per call and the labels
+ * (route fragments) per second.
+ * Dual file: one dual per line, "max <vehicle> <value>", "sct <vehicle> <value>", or "block <location> <time> <value>";
+ * duals that are not in the file are zero. */
+//------------------------------------------------------------------------------------------------------------//
+// Settings
+int REPETITIONS(3); // number of pricing calls per vehicle and scenario (command line: --repetitions)
+int DUAL_SEED(0); // seed of synthetic duals (command line: --seed)
+double BLOCK_DENSITY(0.2); // synthetic duals: share of location-time blocks with positive dual cost
+double BLOCK_SCALE(0.5); // synthetic duals: maximum block cost relative to the sct dual of a vehicle
+double MAX_COST_SLACK(0.3); // synthetic duals: route selection dual is (1 + slack) times the cost of a route with minimum sct
+//------------------------------------------------------------------------------------------------------------//
+struct Benchmark_result {
+    int Calls; // number of pricing calls
+    double Seconds; // pricing time
+    long long Routes; // routes with negative reduced cost
+    Pricing_statistics Statistics; // created and dominated labels
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Read recorded duals from file (see format above). Returns false if the file cannot be read. */
+bool read_duals(string &filename, vector<VecD> &block_cost, vector<Vehicle> &vehicles, int &number_locations, int &horizon) {
+    ifstream file(filename);
+    if (!file)
+        return false;
+    block_cost.assign(number_locations, VecD(horizon, 0.0));
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        (*v_it).Max_cost = 0;
+        (*v_it).Sct_cost = 0;
+    }
+    string line;
+    while (getline(file, line)) {
+        VecS entries;
+        boost::split(entries, line, boost::is_any_of(" "), boost::token_compress_on);
+        if (entries[0] == "max" && entries.size() == 3 && stoi(entries[1]) < (int) vehicles.size())
+            vehicles[stoi(entries[1])].Max_cost = stod(entries[2]);
+        else if (entries[0] == "sct" && entries.size() == 3 && stoi(entries[1]) < (int) vehicles.size())
+            vehicles[stoi(entries[1])].Sct_cost = stod(entries[2]);
+        else if (entries[0] == "block" && entries.size() == 4 && stoi(entries[1]) < number_locations && stoi(entries[2]) < horizon)
+            block_cost[stoi(entries[1])][stoi(entries[2])] = stod(entries[3]);
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Price every vehicle repetitions times on the root node. */
+void benchmark_pricing(Benchmark_result &result, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<VecI> &transportation_times, vector<VecD> &block_cost, int &number_locations, int &number_tasks, int &ub, int &horizon, int &repetitions) {
+    vector<vector<VecI>> fixed_vlt;
+    vector<vector<VecI>> enforced_vlz;
+    vector<vector<VecI>> forbidden_vlz;
+    vector<VecI> start_lb, start_ub;
+    root_node(fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles, locations, number_locations, number_tasks, horizon);
+    Node root;
+    initialize_root_node(root, fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, models, vehicles);
+    determine_available_combinations(models, vehicles, locations, root, number_tasks, number_locations);
+    VecD cut_cost;
+    vector<vector<VecI>> zero_half_cuts;
+    double rc_limit(0.0);
+    bool enumerate(false);
+    int route_limit(0);
+    atomic<bool> stop(false);
+    result = {0, 0.0, 0, {0, 0, 0}};
+    for (int r = 0; r != repetitions; ++r) {
+        for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+            vector<vector<VecI>> new_routes;
+            VecD new_routes_cost;
+            Time_point start_call = wall_clock();
+            find_new_routes(new_routes, new_routes_cost, (*v_it).Id, (*v_it), models[(*v_it).Type], locations, block_cost, cut_cost, zero_half_cuts,
+                            transportation_times, number_locations, number_tasks, root, ub, horizon, rc_limit, enumerate, route_limit, stop, result.Statistics);
+            result.Seconds += elapsed_seconds(start_call);
+            result.Routes += (long long) new_routes.size();
+            ++result.Calls;
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+void print_usage(string executable) {
+    cout << "Usage: " << executable << " [--instance NAME]... [--vehicles N] [--repetitions N] [--seed N] [--duals FILE]" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+    VecS instances;
+    string duals_file;
+    for (int i = 1; i < argc; ++i) {
+        string argument(argv[i]);
+        if (i + 1 == argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        string value(argv[++i]);
+        if (argument == "--instance")
+            instances.push_back(value);
+        else if (argument == "--vehicles")
+            NUMBER_VEHICLES = stoi(value);
+        else if (argument == "--repetitions")
+            REPETITIONS = stoi(value);
+        else if (argument == "--seed")
+            DUAL_SEED = stoi(value);
+        else if (argument == "--duals")
+            duals_file = value;
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (instances.empty())
+        instances = INSTANCE_LIST;
+    cout << "instance;scenario;preprocess_s;scenario_s;calls;ms_per_call;labels_created;labels_dominated;labels_per_s;routes" << endl;
+    for (auto instance_it = instances.begin(); instance_it != instances.end(); ++instance_it) {
+        int number_vehicles(NUMBER_VEHICLES);
+        int number_locations, number_tasks, number_models, cycle_time, total_workload;
+        Location start_loc, end_loc;
+        vector<Model> models;
+        vector<Vehicle> vehicles;
+        vector<Location> locations;
+        vector<VecI> transportation_times;
+        string filename(*instance_it + ".csv");
+        if (!ifstream("Data/Instances_csv/" + filename)) {
+            cout << "WARNING: Instance " << filename << " not found!" << endl;
+            continue;
+        }
+        if (!read_instance(filename, number_models, number_vehicles, number_locations, number_tasks,
+                           models, vehicles, locations, cycle_time, start_loc, end_loc, transportation_times, total_workload))
+            continue;
+        Time_point start_preprocessing = wall_clock();
+        preprocess(models, locations, number_locations, number_tasks, start_loc, end_loc);
+        double time_preprocessing = elapsed_seconds(start_preprocessing);
+        int ub(-1);
+        generate_initial_solution(models, vehicles, locations, transportation_times, number_locations, ub);
+        int horizon(vehicles.back().Arrival_time + ub);
+        for (int scenario = 0; scenario != 4; ++scenario) {
+            vector<Model> scenario_models(models);
+            vector<Vehicle> scenario_vehicles(vehicles);
+            string string_scenario("ERROR");
+            Time_point start_scenario = wall_clock();
+            initialize_models_for_scenario(scenario_models, locations, number_locations, scenario, string_scenario);
+            double time_scenario = elapsed_seconds(start_scenario);
+            vector<VecD> block_cost;
+            if (duals_file.empty())
+                generate_synthetic_duals(block_cost, scenario_models, scenario_vehicles, number_locations, horizon, DUAL_SEED, BLOCK_DENSITY, BLOCK_SCALE,
+                                         MAX_COST_SLACK);
+            else if (!read_duals(duals_file, block_cost, scenario_vehicles, number_locations, horizon)) {
+                cout << "WARNING: Dual file " << duals_file << " could not be read!" << endl;
+                return 1;
+            }
+            Benchmark_result result;
+            benchmark_pricing(result, scenario_models, scenario_vehicles, locations, transportation_times, block_cost, number_locations, number_tasks,
+                              ub, horizon, REPETITIONS);
+            cout << (*instance_it) << ";" << string_scenario << ";" << time_preprocessing << ";" << time_scenario << ";" << result.Calls << ";"
+                 << (result.Calls > 0 ? result.Seconds / result.Calls * 1000 : 0.0) << ";" << result.Statistics.Labels_created << ";"
+                 << result.Statistics.Labels_dominated << ";" << (result.Seconds > 0 ? result.Statistics.Labels_created / result.Seconds : 0.0) << ";"
+                 << result.Routes << endl;
+        }
+    }
+    print_profile();
+    return 0;
+}
+//------------------------------------------------------------------------------------------------------------//
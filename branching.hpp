@@ -9,145 +9,140 @@ typedef vector<bool> VecB;
 typedef vector<double> VecD;
 typedef vector<string> VecS;
 //------------------------------------------------------------------------------------------------------------//
-void branch_on_assign(bool &found, vector<Node> &unsolved, VecI &branched_on, int &id_count, vector<Vehicle> &vehicles, vector<Location> &locations,
-        int &number_locations, int &number_tasks,
-        Node &parent_node, vector<vector<VecD>> &node_split_tasks, double &node_lb, int &v_id) {
-    // find branching variable
-    VecI branch_var;
-    int preference_left(0);
-    double value(-0.1); // branch on task assignment that is closest to 0 or 1
+/* Apply reduced-cost fixings of a solved node to a node in its subtree. */
+void apply_fixings(Node &node, const vector<VecI> &fixings) {
+    for (auto it = fixings.begin(); it != fixings.end(); ++it) {
+        node.Forbidden_vehicle_location_combinations[(*it)[0]][(*it)[1]].push_back((*it)[2]);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Derive full node from root node by applying all branching decisions and reduced-cost fixings on the path from the root node.
+ * Fixings are only applied if they were derived for an ub that is not smaller than the current ub. */
+void materialize_node(Node &node, Open_node &open_node, Node &root, vector<Vehicle> &vehicles, vector<Location> &locations, int &ub) {
+    vector<const Branching_decision*> path;
+    vector<const vector<VecI>*> fixings;
+    for (const Open_node *it = &open_node; it; it = (*it).Parent.get()) {
+        if ((*it).Parent)
+            path.push_back(&(*it).Decision);
+        if (ub <= (*it).Fixings_ub)
+            fixings.push_back(&(*it).Fixings);
+    }
+    node.Id = open_node.Id;
+    node.Lb = open_node.Lb;
+    node.Depth = open_node.Depth;
+    node.Preference = open_node.Preference;
+    node.Fixed_vehicle_location_tasks = root.Fixed_vehicle_location_tasks;
+    node.Enforced_vehicle_location_times = root.Enforced_vehicle_location_times;
+    node.Forbidden_vehicle_location_times = root.Forbidden_vehicle_location_times;
+    node.Task_start_times_lower_bounds = root.Task_start_times_lower_bounds;
+    node.Task_start_times_upper_bounds = root.Task_start_times_upper_bounds;
+    node.Forbidden_vehicle_routes = root.Forbidden_vehicle_routes;
+    node.Forbidden_vehicle_location_combinations = root.Forbidden_vehicle_location_combinations;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        apply_branching_decision(node, *(*it), vehicles, locations);
+    }
+    for (auto it = fixings.rbegin(); it != fixings.rend(); ++it) {
+        apply_fixings(node, *(*it));
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Branching candidate of a vehicle within one branching family. */
+struct Branching_candidate {
+    int Family; // branching family: 0 (ASSIGN), 1 (USAGE), or 2 (TIME)
+    VecI Var; // branching variable: vehicle, location (ASSIGN, USAGE) or task (TIME), task (ASSIGN) or time (USAGE, TIME)
+    double Down_fractionality; // fractional value removed by down branch
+    double Up_fractionality; // fractional value removed by up branch
+    int Preference_left; // preference of down branch
+    int Preference_right; // preference of up branch
+    double Score; // estimated lower bound improvement
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Pseudo-costs: lower bound improvement per unit of fractionality observed in solved child nodes. */
+struct Pseudo_costs {
+    vector<vector<VecD>> Gain; // summed improvement per unit fractionality [family][vehicle][direction]
+    vector<vector<VecI>> Count; // number of observations [family][vehicle][direction]
+};
+//------------------------------------------------------------------------------------------------------------//
+void initialize_pseudo_costs(Pseudo_costs &pseudo_costs, int number_vehicles) {
+    VecD dummy_gain(2, 0.0);
+    VecI dummy_count(2, 0);
+    pseudo_costs.Gain = vector<vector<VecD>>(3, vector<VecD>(number_vehicles, dummy_gain));
+    pseudo_costs.Count = vector<vector<VecI>>(3, vector<VecI>(number_vehicles, dummy_count));
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Record lower bound improvement of a solved node compared to its parent node. */
+void update_pseudo_costs(Pseudo_costs &pseudo_costs, int family, int v_id, int direction, double gain, double fractionality) {
+    if (family < 0 || fractionality < PRECISION)
+        return;
+    pseudo_costs.Gain[family][v_id][direction] += max(0.0, gain) / fractionality;
+    ++pseudo_costs.Count[family][v_id][direction];
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Pseudo-cost of a branching direction. Vehicles without observations use the average over all vehicles of
+ * the family; families without observations use 1. */
+double pseudo_cost(Pseudo_costs &pseudo_costs, int family, int v_id, int direction) {
+    if (pseudo_costs.Count[family][v_id][direction] > 0)
+        return pseudo_costs.Gain[family][v_id][direction] / pseudo_costs.Count[family][v_id][direction];
+    double gain(0.0);
+    int count(0);
+    for (size_t v = 0; v != pseudo_costs.Count[family].size(); ++v) {
+        gain += pseudo_costs.Gain[family][v][direction];
+        count += pseudo_costs.Count[family][v][direction];
+    }
+    if (count > 0)
+        return gain / count;
+    return 1.0;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Product score of the estimated improvements of both branches. */
+double branching_score(double down_gain, double up_gain) {
+    return max(down_gain, PRECISION) * max(up_gain, PRECISION);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Find task assignment of vehicle that is closest to 0 or 1. */
+void find_assign_candidate(bool &found, Branching_candidate &candidate, vector<Location> &locations, int &number_locations, int &number_tasks,
+        vector<vector<VecD>> &node_split_tasks, int v_id) {
+    double value(-0.1);
     for (int t = 1; t != number_tasks - 1; ++t) {
         for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
             if ((*l_it).Id == 0 || (*l_it).Id == number_locations - 1)
                 continue;
-            if (node_split_tasks[v_id][(*l_it).Id][t] > PRECISION &&
-                node_split_tasks[v_id][(*l_it).Id][t] < 1 - PRECISION) {
-                if (abs(node_split_tasks[v_id][(*l_it).Id][t] - 0.5) > value) {
-                    branch_var = {v_id, (*l_it).Id, t};
-                    value = abs(node_split_tasks[v_id][(*l_it).Id][t] - 0.5);
+            double split(node_split_tasks[v_id][(*l_it).Id][t]);
+            if (split > PRECISION && split < 1 - PRECISION) {
+                if (abs(split - 0.5) > value) {
+                    value = abs(split - 0.5);
                     found = true;
-                    if (node_split_tasks[v_id][(*l_it).Id][t] >= 0.5) {
-                        preference_left = 0;
-                    }
-                    else {
-                        preference_left = 1;
-                    }
+                    int preference_left(split >= 0.5 ? 0 : 1);
+                    candidate = {0, {v_id, (*l_it).Id, t}, split, 1 - split, preference_left, preference_left, 0.0};
                 }
             }
         }
     }
-    if (found) {
-        cout << "BRANCH ON ASSIGN: V" << branch_var[0] << " L" << branch_var[1] << " T" << branch_var[2] << " " << parent_node.Depth << endl;
-        ++branched_on[0];
-        // create down branch (left): task not to be performed on location
-        Node new_node1;
-        new_node1.Id = id_count;
-        ++id_count;
-        new_node1.Lb = max(node_lb, parent_node.Lb);
-        new_node1.Depth = parent_node.Depth + 1;
-        new_node1.Preference = parent_node.Preference + preference_left;
-        new_node1.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node1.Fixed_vehicle_location_tasks[branch_var[0]][branch_var[1]][branch_var[2]] = 0;
-        new_node1.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node1.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node1.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node1.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        unsolved.push_back(new_node1);
-        // create up branch (right): task to be performed on location
-        Node new_node2;
-        new_node2.Id = id_count;
-        ++id_count;
-        new_node2.Lb = max(node_lb, parent_node.Lb);
-        new_node2.Depth = parent_node.Depth + 1;
-        new_node2.Preference = parent_node.Preference + preference_left;
-        new_node2.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node2.Fixed_vehicle_location_tasks[branch_var[0]][branch_var[1]][branch_var[2]] = 1;
-        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-            if ((*l_it).Id != branch_var[1] && (*l_it).Assignments[branch_var[2]]) {
-                new_node2.Fixed_vehicle_location_tasks[branch_var[0]][(*l_it).Id][branch_var[2]] = 0;
-            }
-        }
-        new_node2.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node2.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node2.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node2.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        unsolved.push_back(new_node2);
-    }
 }
 //------------------------------------------------------------------------------------------------------------//
-void branch_on_usage(bool &found, vector<Node> &unsolved, VecI &branched_on, int &id_count, vector<Vehicle> &vehicles, vector<Location> &locations,
-        int &number_locations, int &horizon, Node &parent_node, vector<vector<VecD>> &node_split_usage, double &node_lb, int &v_id) {
-    // find branching variable
-    VecI branch_var;
+/* Find location usage of vehicle that is closest to 0 or 1. */
+void find_usage_candidate(bool &found, Branching_candidate &candidate, vector<Location> &locations, int &number_locations, int &horizon,
+        vector<vector<VecD>> &node_split_usage, int v_id) {
     double value(-0.1);
-    int preference_left(0);
     for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
         if ((*l_it).Id == 0 || (*l_it).Id == number_locations - 1)
             continue;
         for (int z = 0; z != horizon; ++z) {
-            if (node_split_usage[v_id][(*l_it).Id][z] > PRECISION && node_split_usage[v_id][(*l_it).Id][z] < 1 - PRECISION) {
-                if (abs(node_split_usage[v_id][(*l_it).Id][z] - 0.5) > value) {
-                    branch_var = {v_id, (*l_it).Id, z};
+            double split(node_split_usage[v_id][(*l_it).Id][z]);
+            if (split > PRECISION && split < 1 - PRECISION) {
+                if (abs(split - 0.5) > value) {
+                    value = abs(split - 0.5);
                     found = true;
-                    value = abs(node_split_usage[v_id][(*l_it).Id][z] - 0.5);
-                    if (node_split_usage[v_id][(*l_it).Id][z] > 0) {
-                        preference_left = 0;
-                    }
-                    else {
-                        preference_left = 1;
-                    }
+                    candidate = {1, {v_id, (*l_it).Id, z}, split, 1 - split, 0, 1, 0.0};
                 }
             }
         }
     }
-    if (found) {
-        cout << "BRANCH ON USAGE: V" << branch_var[0] << " L" << branch_var[1] << " Z" << branch_var[2] << " " << node_split_usage[branch_var[0]][branch_var[1]][branch_var[2]] << " " << parent_node.Depth <<  endl;
-        ++branched_on[1];
-        // create down branch (left): vehicle does not block location at time z
-        Node new_node1;
-        new_node1.Id = id_count;
-        ++id_count;
-        new_node1.Lb = max(node_lb, parent_node.Lb);
-        new_node1.Depth = parent_node.Depth + 1;
-        new_node1.Preference = parent_node.Preference + preference_left;
-        new_node1.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node1.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node1.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node1.Forbidden_vehicle_location_times[branch_var[0]][branch_var[1]].push_back(branch_var[2]);
-        new_node1.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node1.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        unsolved.push_back(new_node1);
-        // create up branch (right): vehicle blocks location at time z
-        Node new_node2;
-        new_node2.Id = id_count;
-        ++id_count;
-        new_node2.Lb = max(node_lb, parent_node.Lb);
-        new_node2.Depth = parent_node.Depth + 1;
-        new_node2.Preference = parent_node.Preference + (1 - preference_left);
-        new_node2.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node2.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node2.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node2.Enforced_vehicle_location_times[branch_var[0]][branch_var[1]].push_back(branch_var[2]);
-        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-            if ((*l_it).Id != branch_var[1]) {
-                new_node2.Forbidden_vehicle_location_times[branch_var[0]][(*l_it).Id].push_back(branch_var[2]);
-            }
-        }
-        for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
-            if ((*v_it).Id != branch_var[0]) {
-                new_node2.Forbidden_vehicle_location_times[(*v_it).Id][branch_var[1]].push_back(branch_var[2]);
-            }
-        }
-        new_node2.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node2.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        unsolved.push_back(new_node2);
-    }
 }
 //------------------------------------------------------------------------------------------------------------//
-void branch_on_time(bool &found, vector<Node> &unsolved, VecI &branched_on, int &id_count, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
-        int &number_locations, int &number_tasks, int &horizon,
-        Node &parent_node, vector<vector<VecD>> &node_split_times, double &node_lb, int &v_id) {
-    // find branching variable
+/* Find task of vehicle with the narrowest range of split start times; branch at the middle of the range. */
+void find_time_candidate(bool &found, Branching_candidate &candidate, int &number_tasks, int &horizon,
+        vector<vector<VecD>> &node_split_times, int v_id) {
     VecI branch_var;
     int min_split_range(horizon + 1);
     for (int t = 1; t != number_tasks - 1; ++t) {
@@ -179,37 +174,87 @@ void branch_on_time(bool &found, vector<Node> &unsolved, VecI &branched_on, int
         if (sum_lower < 0.5) {
             preference_left = 0;
         }
-        cout << "BRANCH ON TIME: V" << branch_var[0] << " T" << branch_var[1] << " Z" << branch_var[2] << " " << parent_node.Depth << endl;
-        ++branched_on[2];
-        Model model(*(models.begin() + (*(vehicles.begin() + branch_var[0])).Type));
-        // create down branch (left): task has to be performed earlier than branch time
-        Node new_node1;
-        new_node1.Id = id_count;
-        ++id_count;
-        new_node1.Lb = max(node_lb, parent_node.Lb);
-        new_node1.Depth = parent_node.Depth + 1;
-        new_node1.Preference = parent_node.Preference + preference_left;
-        new_node1.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node1.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node1.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node1.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node1.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        new_node1.Task_start_times_upper_bounds[branch_var[0]][branch_var[1]] = branch_var[2];
-        unsolved.push_back(new_node1);
-        // create up branch (right): task has to be performed later or equal than branch time
-        Node new_node2;
-        new_node2.Id = id_count;
-        ++id_count;
-        new_node2.Lb = max(node_lb, parent_node.Lb);
-        new_node2.Depth = parent_node.Depth + 1;
-        new_node2.Preference = parent_node.Preference + (1 - preference_left);
-        new_node2.Fixed_vehicle_location_tasks = parent_node.Fixed_vehicle_location_tasks;
-        new_node2.Enforced_vehicle_location_times = parent_node.Enforced_vehicle_location_times;
-        new_node2.Forbidden_vehicle_location_times = parent_node.Forbidden_vehicle_location_times;
-        new_node2.Task_start_times_lower_bounds = parent_node.Task_start_times_lower_bounds;
-        new_node2.Task_start_times_upper_bounds = parent_node.Task_start_times_upper_bounds;
-        new_node2.Task_start_times_lower_bounds[branch_var[0]][branch_var[1]] = branch_var[2] + 1;
-        unsolved.push_back(new_node2);
+        candidate = {2, branch_var, 1 - sum_lower, sum_lower, preference_left, 1 - preference_left, 0.0};
     }
 }
-//------------------------------------------------------------------------------------------------------------//
\ No newline at end of file
+//------------------------------------------------------------------------------------------------------------//
+/* Collect one branching candidate per vehicle and branching family. Candidates are listed in the order of the
+ * BRANCHING rule: vehicles with the largest current sct first, families in the order given by branching. */
+void find_branching_candidates(vector<Branching_candidate> &candidates, vector<Vehicle> &vehicles, vector<Location> &locations,
+        int &number_locations, int &number_tasks, int &horizon, VecS &branching, vector<vector<VecD>> &node_split_usage,
+        vector<vector<VecD>> &node_split_tasks, vector<vector<VecD>> &node_split_times) {
+    VecI sorted_vehicles;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        sorted_vehicles.push_back((*v_it).Id);
+    }
+    sort(sorted_vehicles.begin(), sorted_vehicles.end());
+    stable_sort(sorted_vehicles.begin(), sorted_vehicles.end(), [&vehicles](const auto &v1, const auto &v2) {return vehicles[v1].Current_sct > vehicles[v2].Current_sct;});
+    for (auto v_it = sorted_vehicles.begin(); v_it != sorted_vehicles.end(); ++v_it) {
+        for (auto it = branching.begin(); it != branching.end(); ++it) {
+            bool found(false);
+            Branching_candidate candidate;
+            if (*it == "ASSIGN") {
+                find_assign_candidate(found, candidate, locations, number_locations, number_tasks, node_split_tasks, *v_it);
+            } else if (*it == "USAGE") {
+                find_usage_candidate(found, candidate, locations, number_locations, horizon, node_split_usage, *v_it);
+            } else if (*it == "TIME") {
+                find_time_candidate(found, candidate, number_tasks, horizon, node_split_times, *v_it);
+            }
+            if (found)
+                candidates.push_back(candidate);
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Score candidates by pseudo-costs. */
+void score_branching_candidates(vector<Branching_candidate> &candidates, Pseudo_costs &pseudo_costs) {
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        double down_gain(pseudo_cost(pseudo_costs, (*it).Family, (*it).Var[0], 0) * (*it).Down_fractionality);
+        double up_gain(pseudo_cost(pseudo_costs, (*it).Family, (*it).Var[0], 1) * (*it).Up_fractionality);
+        (*it).Score = branching_score(down_gain, up_gain);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Index of the candidate with the highest score; ties are broken by candidate order. */
+int best_branching_candidate(vector<Branching_candidate> &candidates) {
+    int best(0);
+    for (int i = 1; i != (int) candidates.size(); ++i) {
+        if (candidates[i].Score > candidates[best].Score)
+            best = i;
+    }
+    return best;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Add child node that differs from its parent node by one branching decision to open nodes. */
+void create_child_node(Open_nodes &unsolved, int &id_count, shared_ptr<const Open_node> &parent_node, double &node_lb,
+        int preference, int family, int direction, VecI &branch_var, double fractionality) {
+    Open_node new_node;
+    new_node.Id = id_count;
+    ++id_count;
+    new_node.Lb = max(node_lb, (*parent_node).Lb);
+    new_node.Depth = (*parent_node).Depth + 1;
+    new_node.Preference = (*parent_node).Preference + preference;
+    new_node.Parent = parent_node;
+    new_node.Decision = {family, direction, branch_var[0], branch_var[1], branch_var[2]};
+    new_node.Fractionality = fractionality;
+    new_node.Fixings_ub = 0;
+    push_open_node(unsolved, new_node);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Create down branch (left) and up branch (right) of branching candidate. */
+void create_branches(Open_nodes &unsolved, VecI &branched_on, int &id_count, shared_ptr<const Open_node> &parent_node,
+        Branching_candidate &candidate, double &node_lb) {
+    if (candidate.Family == 0) {
+        cout << "BRANCH ON ASSIGN: V" << candidate.Var[0] << " L" << candidate.Var[1] << " T" << candidate.Var[2] << " " << (*parent_node).Depth << endl;
+    }
+    else if (candidate.Family == 1) {
+        cout << "BRANCH ON USAGE: V" << candidate.Var[0] << " L" << candidate.Var[1] << " Z" << candidate.Var[2] << " " << candidate.Down_fractionality << " " << (*parent_node).Depth <<  endl;
+    }
+    else {
+        cout << "BRANCH ON TIME: V" << candidate.Var[0] << " T" << candidate.Var[1] << " Z" << candidate.Var[2] << " " << (*parent_node).Depth << endl;
+    }
+    ++branched_on[candidate.Family];
+    create_child_node(unsolved, id_count, parent_node, node_lb, candidate.Preference_left, candidate.Family, 0, candidate.Var, candidate.Down_fractionality);
+    create_child_node(unsolved, id_count, parent_node, node_lb, candidate.Preference_right, candidate.Family, 1, candidate.Var, candidate.Up_fractionality);
+}
+//------------------------------------------------------------------------------------------------------------//
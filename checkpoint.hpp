@@ -0,0 +1,312 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Checkpoints of scenario solves in a binary file, used to resume a solve after the time limit or a crash.
+ * A checkpoint of a running threshold search stores the search state (bounds, incumbent, next threshold), the leaves
+ * of the B&B tree with their decision paths, the pseudo-costs, and the column pool. Ancestors shared by several
+ * leaves are stored once. A checkpoint of a finished scenario stores its result. Checkpoints carry the instance key
+ * (see instance_key) and only match the instance that wrote them; their routes are validated when read. All values are written in native
+ * byte order, i.e., checkpoints are only read on the machine type that wrote them. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+const int CHECKPOINT_VERSION(3); // incremented whenever the file layout changes
+//------------------------------------------------------------------------------------------------------------//
+struct Search_checkpoint {
+    uint64_t Key = 0; // key of instance (see instance_key)
+    bool Finished = false; // scenario is solved: only Ub, Best_sol, Elapsed, and Iterations are used
+    int Ub = 0; // incumbent segment cycle time
+    VecI Best_sol; // routes of incumbent
+    int Horizon = 0; // horizon derived from incumbent
+    int Lb = 0; // lower bound of threshold search (next threshold is derived from it)
+    int Proven_lb = 0; // proven lower bound
+    int Step = 1; // GALLOP: current step
+    bool Solution_found = false; // a threshold was met
+    int Iterations = 0; // number of finished thresholds
+    double Elapsed = 0.0; // elapsed time of scenario in seconds
+    int Id_count = 0; // next node identifier
+    int Explored_nodes = 0; // number of solved nodes
+    VecI Branched_on; // number of branchings per branching family
+    Pseudo_costs Branching_costs; // pseudo-costs of branching families and vehicles
+    vector<Open_node> Leaves; // open and retired leaves of tree
+};
+//------------------------------------------------------------------------------------------------------------//
+// Binary I/O of plain values, strings, and (nested) vectors
+template <typename T> void write_binary(ofstream &file, const T &value) {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+void write_binary(ofstream &file, const string &value) {
+    write_binary(file, (int) value.size());
+    file.write(value.data(), (streamsize) value.size());
+}
+template <typename T> void write_binary(ofstream &file, const vector<T> &values) {
+    write_binary(file, (int) values.size());
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        write_binary(file, (*it));
+    }
+}
+template <typename T> void read_binary(ifstream &file, T &value) {
+    file.read(reinterpret_cast<char *>(&value), sizeof(T));
+}
+void read_binary(ifstream &file, string &value) {
+    int size(0);
+    read_binary(file, size);
+    value.assign(max(0, size), ' ');
+    file.read(&value[0], (streamsize) value.size());
+}
+template <typename T> void read_binary(ifstream &file, vector<T> &values) {
+    int size(0);
+    read_binary(file, size);
+    values.clear();
+    for (int i = 0; i < size && file; ++i) {
+        T value;
+        read_binary(file, value);
+        values.push_back(value);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write open node without parent pointer; parent is the identifier of the parent node (-1 for the root node). */
+void write_open_node(ofstream &file, const Open_node &node, int parent) {
+    write_binary(file, node.Id);
+    write_binary(file, parent);
+    write_binary(file, node.Lb);
+    write_binary(file, node.Depth);
+    write_binary(file, node.Preference);
+    write_binary(file, VecI({node.Decision.Family, node.Decision.Direction, node.Decision.Vehicle, node.Decision.Index, node.Decision.Value}));
+    write_binary(file, node.Fractionality);
+    write_binary(file, node.Fixings);
+    write_binary(file, node.Fixings_ub);
+}
+//------------------------------------------------------------------------------------------------------------//
+void read_open_node(ifstream &file, Open_node &node, int &parent) {
+    read_binary(file, node.Id);
+    read_binary(file, parent);
+    read_binary(file, node.Lb);
+    read_binary(file, node.Depth);
+    read_binary(file, node.Preference);
+    VecI decision;
+    read_binary(file, decision);
+    decision.resize(5, 0);
+    node.Decision = {decision[0], decision[1], decision[2], decision[3], decision[4]};
+    read_binary(file, node.Fractionality);
+    read_binary(file, node.Fixings);
+    read_binary(file, node.Fixings_ub);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write leaves and their ancestors: ancestors first (each once), then the leaves. */
+void write_leaves(ofstream &file, vector<Open_node> &leaves) {
+    vector<const Open_node *> ancestors;
+    map<int, bool> written;
+    for (auto it = leaves.begin(); it != leaves.end(); ++it) {
+        vector<const Open_node *> path;
+        for (const Open_node *node = (*it).Parent.get(); node != nullptr && !written[(*node).Id]; node = (*node).Parent.get()) {
+            written[(*node).Id] = true;
+            path.push_back(node);
+        }
+        ancestors.insert(ancestors.end(), path.rbegin(), path.rend());
+    }
+    write_binary(file, (int) ancestors.size());
+    for (auto it = ancestors.begin(); it != ancestors.end(); ++it) {
+        write_open_node(file, *(*it), (*(*it)).Parent ? (*(*it)).Parent->Id : -1);
+    }
+    write_binary(file, (int) leaves.size());
+    for (auto it = leaves.begin(); it != leaves.end(); ++it) {
+        write_open_node(file, (*it), (*it).Parent ? (*it).Parent->Id : -1);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+void read_leaves(ifstream &file, vector<Open_node> &leaves) {
+    map<int, shared_ptr<const Open_node>> ancestors;
+    int number_ancestors(0);
+    read_binary(file, number_ancestors);
+    for (int i = 0; i < number_ancestors && file; ++i) {
+        Open_node node;
+        int parent(-1);
+        read_open_node(file, node, parent);
+        if (parent >= 0)
+            node.Parent = ancestors[parent];
+        ancestors[node.Id] = make_shared<const Open_node>(move(node));
+    }
+    int number_leaves(0);
+    read_binary(file, number_leaves);
+    leaves.clear();
+    for (int i = 0; i < number_leaves && file; ++i) {
+        Open_node node;
+        int parent(-1);
+        read_open_node(file, node, parent);
+        if (parent >= 0)
+            node.Parent = ancestors[parent];
+        leaves.push_back(move(node));
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write routes of column pool (blockings are derived from the routes when reading). */
+void write_column_pool(ofstream &file, vector<Vehicle> &vehicles) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        write_binary(file, (*v_it).Route_details);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check if routes (per vehicle) are valid routes of the vehicles (see validate_route). */
+bool checkpoint_routes_are_valid(vector<vector<vector<VecI>>> &routes, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<VecI> &transportation_times, int &number_locations, int &number_tasks, int &horizon) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        for (auto r_it = routes[(*v_it).Id].begin(); r_it != routes[(*v_it).Id].end(); ++r_it) {
+            if (!validate_route((*r_it), (*v_it), models[(*v_it).Type], locations, transportation_times, number_locations, number_tasks, horizon))
+                return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Replace routes of column pool and rebuild blockings. The routes of all vehicles are read and validated first; vehicles
+ * and blockings are only changed if the pool is read completely and all routes are valid. Returns false otherwise. */
+bool read_column_pool(ifstream &file, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, vector<VecI> &transportation_times,
+        vector<vector<vector<VecI>>> &blockings, int &number_locations, int &number_tasks) {
+    int horizon(blockings.empty() ? 0 : (int) blockings[0].size());
+    vector<vector<vector<VecI>>> pool(vehicles.size());
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        read_binary(file, pool[(*v_it).Id]);
+        if (!file)
+            return false;
+    }
+    if (!checkpoint_routes_are_valid(pool, models, vehicles, locations, transportation_times, number_locations, number_tasks, horizon))
+        return false;
+    for (auto l_it = blockings.begin(); l_it != blockings.end(); ++l_it) {
+        for (auto z_it = (*l_it).begin(); z_it != (*l_it).end(); ++z_it) {
+            (*z_it).clear();
+        }
+    }
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        (*v_it).All_routes.clear();
+        (*v_it).Available_routes.clear();
+        (*v_it).Route_details.clear();
+        (*v_it).Route_scts.clear();
+        (*v_it).Route_start_times.clear();
+        (*v_it).Route_end_times.clear();
+        for (auto r_it = pool[(*v_it).Id].begin(); r_it != pool[(*v_it).Id].end(); ++r_it) {
+            add_route_to_pool((*v_it), (*r_it), models[(*v_it).Type], blockings, number_locations);
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+void write_checkpoint(string &filename, Search_checkpoint &checkpoint, vector<Vehicle> &vehicles) {
+    // write to temporary file first such that a crash while writing keeps the previous checkpoint
+    string temporary(filename + ".tmp");
+    ofstream file(temporary, ios::binary | ios::trunc);
+    if (!file) {
+        cout << "WARNING: Checkpoint " << filename << " could not be written!" << endl;
+        return;
+    }
+    write_binary(file, CHECKPOINT_VERSION);
+    write_binary(file, checkpoint.Key);
+    write_binary(file, checkpoint.Finished);
+    write_binary(file, checkpoint.Ub);
+    write_binary(file, checkpoint.Elapsed);
+    write_binary(file, checkpoint.Iterations);
+    vector<vector<VecI>> solution;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        solution.push_back((*v_it).Route_details[checkpoint.Best_sol[(*v_it).Id]]);
+    }
+    write_binary(file, solution);
+    if (!checkpoint.Finished) {
+        write_binary(file, checkpoint.Horizon);
+        write_binary(file, checkpoint.Lb);
+        write_binary(file, checkpoint.Proven_lb);
+        write_binary(file, checkpoint.Step);
+        write_binary(file, checkpoint.Solution_found);
+        write_binary(file, checkpoint.Id_count);
+        write_binary(file, checkpoint.Explored_nodes);
+        write_binary(file, checkpoint.Branched_on);
+        write_binary(file, checkpoint.Branching_costs.Gain);
+        write_binary(file, checkpoint.Branching_costs.Count);
+        write_leaves(file, checkpoint.Leaves);
+        write_column_pool(file, vehicles);
+    }
+    file.close();
+    if (rename(temporary.c_str(), filename.c_str()) != 0)
+        cout << "WARNING: Checkpoint " << filename << " could not be written!" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check if checkpoint of instance with key exists and belongs to a finished scenario. */
+bool checkpoint_is_finished(string &filename, uint64_t &key) {
+    ifstream file(filename, ios::binary);
+    int version(0);
+    uint64_t file_key(0);
+    bool finished(false);
+    read_binary(file, version);
+    read_binary(file, file_key);
+    read_binary(file, finished);
+    return file && version == CHECKPOINT_VERSION && file_key == key && finished;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Read checkpoint of instance with key. The column pool of a running search replaces the pool of vehicles; the incumbent
+ * of a finished scenario is added to the pool. Returns false if there is no valid checkpoint (the pool is unchanged). */
+bool read_checkpoint(string &filename, uint64_t &key, Search_checkpoint &checkpoint, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecI> &transportation_times, vector<vector<vector<VecI>>> &blockings, int &number_locations, int &number_tasks) {
+    ifstream file(filename, ios::binary);
+    if (!file)
+        return false;
+    int version(0);
+    read_binary(file, version);
+    if (version != CHECKPOINT_VERSION) {
+        cout << "WARNING: Checkpoint " << filename << " has version " << version << " instead of " << CHECKPOINT_VERSION << "!" << endl;
+        return false;
+    }
+    read_binary(file, checkpoint.Key);
+    if (checkpoint.Key != key) {
+        cout << "WARNING: Checkpoint " << filename << " does not match instance!" << endl;
+        return false;
+    }
+    read_binary(file, checkpoint.Finished);
+    read_binary(file, checkpoint.Ub);
+    read_binary(file, checkpoint.Elapsed);
+    read_binary(file, checkpoint.Iterations);
+    vector<vector<VecI>> solution;
+    read_binary(file, solution);
+    if (!file || solution.size() != vehicles.size())
+        return false;
+    int horizon(blockings.empty() ? 0 : (int) blockings[0].size());
+    vector<vector<vector<VecI>>> solution_routes;
+    for (auto r_it = solution.begin(); r_it != solution.end(); ++r_it) {
+        solution_routes.push_back({(*r_it)});
+    }
+    if (!checkpoint_routes_are_valid(solution_routes, models, vehicles, locations, transportation_times, number_locations, number_tasks, horizon)) {
+        cout << "WARNING: Checkpoint " << filename << " contains invalid routes!" << endl;
+        return false;
+    }
+    if (!checkpoint.Finished) {
+        read_binary(file, checkpoint.Horizon);
+        read_binary(file, checkpoint.Lb);
+        read_binary(file, checkpoint.Proven_lb);
+        read_binary(file, checkpoint.Step);
+        read_binary(file, checkpoint.Solution_found);
+        read_binary(file, checkpoint.Id_count);
+        read_binary(file, checkpoint.Explored_nodes);
+        read_binary(file, checkpoint.Branched_on);
+        read_binary(file, checkpoint.Branching_costs.Gain);
+        read_binary(file, checkpoint.Branching_costs.Count);
+        read_leaves(file, checkpoint.Leaves);
+        if (!file)
+            return false;
+        if (!read_column_pool(file, models, vehicles, locations, transportation_times, blockings, number_locations, number_tasks)) {
+            cout << "WARNING: Checkpoint " << filename << " contains an invalid column pool!" << endl;
+            return false;
+        }
+    }
+    checkpoint.Best_sol.assign(vehicles.size(), 0);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        auto it(find((*v_it).Route_details.begin(), (*v_it).Route_details.end(), solution[(*v_it).Id]));
+        if (it != (*v_it).Route_details.end())
+            checkpoint.Best_sol[(*v_it).Id] = (int) distance((*v_it).Route_details.begin(), it);
+        else
+            checkpoint.Best_sol[(*v_it).Id] = add_route_to_pool((*v_it), solution[(*v_it).Id], models[(*v_it).Type], blockings, number_locations);
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
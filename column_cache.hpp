@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Column cache: the routes of the column pool of a scenario are stored on disk and loaded by later runs of the same
+ * instance to warm-start the master problem. Cache files are keyed by a FNV-1a hash of the instance file and the
+ * number of vehicles; a changed instance gets a new key. Each route is stored as flat sequence of (location,
+ * task_combination, time) tuples. Loaded routes are validated against the current instance before entering the pool. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+const int COLUMN_CACHE_VERSION(1); // incremented whenever the file layout changes
+//------------------------------------------------------------------------------------------------------------//
+/* FNV-1a hash of bytes, continuing from hash. */
+uint64_t fnv1a(const char *bytes, size_t size, uint64_t hash = 14695981039346656037ULL) {
+    for (size_t i = 0; i != size; ++i) {
+        hash ^= (unsigned char) bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Key of instance: hash of instance file (in Data/Instances_csv) and number of vehicles. */
+uint64_t instance_key(string &filename, int &number_vehicles) {
+    ifstream file("Data/Instances_csv/" + filename, ios::binary);
+    string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    uint64_t hash(fnv1a(content.data(), content.size()));
+    return fnv1a(reinterpret_cast<const char *>(&number_vehicles), sizeof(number_vehicles), hash);
+}
+//------------------------------------------------------------------------------------------------------------//
+string column_cache_file(uint64_t &key, string &string_scenario) {
+    stringstream name;
+    name << "Results/Columns/" << hex << setw(16) << setfill('0') << key << "_" << string_scenario << ".bin";
+    return name.str();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Store routes of column pool in cache file. */
+void write_column_cache(string filename, uint64_t &key, vector<Vehicle> &vehicles) {
+    string temporary(filename + ".tmp");
+    ofstream file(temporary, ios::binary | ios::trunc);
+    if (!file) {
+        cout << "WARNING: Column cache " << filename << " could not be written!" << endl;
+        return;
+    }
+    write_binary(file, COLUMN_CACHE_VERSION);
+    write_binary(file, key);
+    write_binary(file, (int) vehicles.size());
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        write_binary(file, (int) (*v_it).Route_details.size());
+        for (auto r_it = (*v_it).Route_details.begin(); r_it != (*v_it).Route_details.end(); ++r_it) {
+            VecI flat;
+            for (auto x_it = (*r_it).begin(); x_it != (*r_it).end(); ++x_it) {
+                flat.insert(flat.end(), (*x_it).begin(), (*x_it).end());
+            }
+            write_binary(file, flat);
+        }
+    }
+    file.close();
+    if (rename(temporary.c_str(), filename.c_str()) != 0)
+        cout << "WARNING: Column cache " << filename << " could not be written!" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Add valid routes of cache file that are not in the column pool to it. Returns the number of added routes. */
+int read_column_cache(string filename, uint64_t &key, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<VecI> &transportation_times, vector<vector<vector<VecI>>> &blockings, int &number_locations, int &number_tasks) {
+    ifstream file(filename, ios::binary);
+    if (!file)
+        return 0;
+    int version(0), number_vehicles(0);
+    uint64_t file_key(0);
+    read_binary(file, version);
+    read_binary(file, file_key);
+    read_binary(file, number_vehicles);
+    if (!file || version != COLUMN_CACHE_VERSION || file_key != key || number_vehicles != (int) vehicles.size()) {
+        cout << "WARNING: Column cache " << filename << " does not match instance!" << endl;
+        return 0;
+    }
+    int horizon(blockings.empty() ? 0 : (int) blockings[0].size());
+    int added(0), invalid(0);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end() && file; ++v_it) {
+        int number_routes(0);
+        read_binary(file, number_routes);
+        for (int r = 0; r < number_routes && file; ++r) {
+            VecI flat;
+            read_binary(file, flat);
+            vector<VecI> route;
+            for (size_t i = 0; i + 2 < flat.size(); i += 3) {
+                route.push_back({flat[i], flat[i + 1], flat[i + 2]});
+            }
+            Model &model(models[(*v_it).Type]);
+            if (!validate_route(route, (*v_it), model, locations, transportation_times, number_locations, number_tasks, horizon)) {
+                ++invalid;
+                continue;
+            }
+            if (find((*v_it).Route_details.begin(), (*v_it).Route_details.end(), route) != (*v_it).Route_details.end())
+                continue;
+            add_route_to_pool((*v_it), route, model, blockings, number_locations);
+            ++added;
+        }
+    }
+    if (invalid > 0)
+        cout << "WARNING: Column cache " << filename << " contains " << invalid << " invalid routes!" << endl;
+    return added;
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,369 @@
+//------------------------------------------------------------------------------------------------------------//
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <memory>
+#include <boost/algorithm/string.hpp>
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <future>
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <type_traits>
+#if defined(PROFILING) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(PROFILING) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+#ifdef WITH_GUROBI
+#include "gurobi_c++.h"
+#endif
+#include <math.h>
+#include "timer.hpp"
+#include "profiler.hpp"
+#include "telemetry.hpp"
+#include "instance_list.hpp"
+#include "instance_reader.hpp"
+#include "preprocessing.hpp"
+#include "preprocess_scenario.hpp"
+#include "initial_solution.hpp"
+#ifdef WITH_GUROBI
+#include "mip_ub_solver.hpp"
+#endif
+#include "route_finder.hpp"
+#include "pricer.hpp"
+#ifdef WITH_GUROBI
+#include "master_problem.hpp"
+#include "aux_node.hpp"
+#include "pricing_scheduler.hpp"
+#include "memory_accounting.hpp"
+#include "search_settings.hpp"
+#include "node_solver.hpp"
+#include "node_queue.hpp"
+#include "branching.hpp"
+#include "checkpoint.hpp"
+#include "column_cache.hpp"
+#include "heuristics.hpp"
+#include "scenario_bounds.hpp"
+#include "bandp.hpp"
+#endif
+#include "instance_generator.hpp"
+#include "synthetic_duals.hpp"
+#include "differential.hpp"
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* Differential harness: runs the reference path and candidate engines side by side on small generated instances and
+ * reports every difference (see differential.hpp). Exits with 1 if a check failed.
+ * Pricing (always): LABELING against the engines in PRICING_ENGINES on the root node of every scenario with synthetic duals
+ * and on nodes derived by random branching decisions with synthetic duals and zero-half cuts.
+ * Optimal sct (with Gurobi): threshold search with branch-and-price of the reference configuration (labeling, one thread,
+ * depth-first search, no heuristics or accelerations) against configurations that each switch on one optimization,
+ * and against a configuration that combines them. Runs that reach the time limit are skipped. */
+//------------------------------------------------------------------------------------------------------------//
+// Settings
+int INSTANCES(3); // number of generated instances (consecutive seeds; command line: --instances)
+int FIRST_SEED(1000); // seed of the first instance (command line: --seed)
+int DUAL_ROUNDS(3); // pricing: number of synthetic duals per scenario
+int BRANCHED_NODES(3); // pricing: number of nodes with random branching decisions per scenario
+int BRANCHING_DEPTH(3); // pricing: number of random branching decisions of these nodes
+VecS PRICING_ENGINES{"PULSE", "RACE"}; // pricing: candidate engines
+int PULSE_LABELS(50); // pricing: maximum number of explored route fragments kept per location by pulse search
+double BLOCK_DENSITY(0.2); // synthetic duals: share of location-time blocks with positive dual cost
+double BLOCK_SCALE(0.5); // synthetic duals: maximum block cost relative to the sct dual of a vehicle
+double MAX_COST_SLACK(0.3); // synthetic duals: route selection dual is (1 + slack) times the cost of a route with minimum sct
+int CUTS(5); // synthetic duals: number of zero-half cuts at the branched nodes
+int CUT_SIZE(3); // synthetic duals: location-times per zero-half cut
+double CUT_SCALE(0.5); // synthetic duals: maximum cut cost relative to the sct dual of a vehicle
+double TIME_LIMIT(120.0); // time limit of a threshold search (command line: --time-limit)
+//------------------------------------------------------------------------------------------------------------//
+#ifdef WITH_GUROBI
+struct Solver_configuration {
+    string Name; // name of the configuration in the report
+    Search_settings Settings; // settings of the threshold search (the time limit is TIME_LIMIT)
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Reference path: every vehicle is priced by labeling in every round, one thread, and no heuristics or accelerations. */
+Solver_configuration reference_configuration() {
+    Solver_configuration reference;
+    reference.Name = "REFERENCE";
+    reference.Settings.Pricing_vehicles = 1000;
+    reference.Settings.Pulse_labels = PULSE_LABELS;
+    return reference;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Candidate configurations: each switches on one optimization of the reference; COMBINED switches on all of them (one thread). */
+vector<Solver_configuration> candidate_configurations() {
+    vector<Solver_configuration> candidates;
+    Solver_configuration candidate(reference_configuration());
+    candidate.Name = "PULSE";
+    candidate.Settings.Pricing_engine = "PULSE";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "RACE";
+    candidate.Settings.Pricing_engine = "RACE";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "THREADS";
+    candidate.Settings.Threads = 4;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "BEST_BOUND";
+    candidate.Settings.Node_selection = "BEST_BOUND";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "PSEUDOCOST";
+    candidate.Settings.Branching_rule = "PSEUDOCOST";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "STRONG";
+    candidate.Settings.Branching_rule = "STRONG";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "PRICING_ROUNDS";
+    candidate.Settings.Pricing_vehicles = 5;
+    candidate.Settings.Async_pricing = true;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "COLUMN_MANAGEMENT";
+    candidate.Settings.Column_selection = "MIXED";
+    candidate.Settings.Column_transfer = true;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "REDUCED_COST_FIXING";
+    candidate.Settings.Reduced_cost_fixing = true;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "ENUMERATION";
+    candidate.Settings.Enumeration_gap = 3.0;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "HEURISTICS";
+    candidate.Settings.Mip_search_frequency = 50;
+    candidate.Settings.Route_mip_time_limit = 5.0;
+    candidate.Settings.Diving_frequency = 100;
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "GALLOP";
+    candidate.Settings.Threshold_search = "GALLOP";
+    candidates.push_back(candidate);
+    candidate = reference_configuration();
+    candidate.Name = "COMBINED";
+    candidate.Settings.Pricing_vehicles = 5;
+    candidate.Settings.Async_pricing = true;
+    candidate.Settings.Column_selection = "MIXED";
+    candidate.Settings.Column_transfer = true;
+    candidate.Settings.Reduced_cost_fixing = true;
+    candidate.Settings.Enumeration_gap = 3.0;
+    candidate.Settings.Mip_search_frequency = 50;
+    candidate.Settings.Route_mip_time_limit = 5.0;
+    candidate.Settings.Diving_frequency = 100;
+    candidates.push_back(candidate);
+    return candidates;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Solve scenario by threshold search with configuration on a private copy of the column pool. Returns false if the
+ * time limit is reached. */
+bool solve_with_configuration(Solver_configuration &configuration, int scenario, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecI> &transportation_times, int &number_locations, int &number_tasks, int ub,
+        int &sol_sct, VecI &sol_routes) {
+    int horizon(vehicles.back().Arrival_time + ub);
+    vector<vector<vector<VecI>>> blockings;
+    initialize_blockings(blockings, locations, vehicles, horizon);
+    sol_routes.assign(vehicles.size(), 0);
+    sol_sct = ub;
+    Scenario_bounds bounds;
+    initialize_scenario_bounds(bounds, ub, sol_routes, vehicles);
+    int iterations(0);
+    Search_settings settings(configuration.Settings);
+    settings.Time_limit = TIME_LIMIT;
+    uint64_t key(0);
+    Time_point start_scenario = wall_clock();
+    solve_threshold_search(models, vehicles, locations, number_locations, number_tasks, blockings, transportation_times,
+                           sol_routes, horizon, sol_sct, iterations, start_scenario, settings, bounds, scenario, key);
+    return elapsed_seconds(start_scenario) < TIME_LIMIT;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Compare optimal sct of the candidate configurations with the reference in scenario. */
+void compare_optimal_sct(Differential_report &report, string context, int scenario, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecI> &transportation_times, int &number_locations, int &number_tasks, int &ub) {
+    Solver_configuration reference(reference_configuration());
+    vector<Vehicle> reference_vehicles(vehicles);
+    int reference_sct;
+    VecI reference_routes;
+    if (!solve_with_configuration(reference, scenario, models, reference_vehicles, locations, transportation_times, number_locations, number_tasks, ub,
+                                  reference_sct, reference_routes)) {
+        cout << "SKIPPED: " << context << " REFERENCE reached the time limit" << endl;
+        ++report.Skipped;
+        return;
+    }
+    int horizon(vehicles.back().Arrival_time + ub);
+    check_solution(report, context + " REFERENCE", reference_routes, reference_sct, models, reference_vehicles, locations, transportation_times,
+                   number_locations, number_tasks, horizon);
+    vector<Solver_configuration> candidates(candidate_configurations());
+    for (auto c_it = candidates.begin(); c_it != candidates.end(); ++c_it) {
+        vector<Vehicle> candidate_vehicles(vehicles);
+        int candidate_sct;
+        VecI candidate_routes;
+        if (!solve_with_configuration((*c_it), scenario, models, candidate_vehicles, locations, transportation_times, number_locations, number_tasks, ub,
+                                      candidate_sct, candidate_routes)) {
+            cout << "SKIPPED: " << context << " " << (*c_it).Name << " reached the time limit" << endl;
+            ++report.Skipped;
+            continue;
+        }
+        check_solution(report, context + " " + (*c_it).Name, candidate_routes, candidate_sct, models, candidate_vehicles, locations,
+                       transportation_times, number_locations, number_tasks, horizon);
+        report_check(report, candidate_sct == reference_sct,
+                     context + " " + (*c_it).Name + ": optimal sct " + to_string(candidate_sct) + ", reference " + to_string(reference_sct));
+    }
+}
+#endif
+//------------------------------------------------------------------------------------------------------------//
+void print_usage(string executable) {
+    cout << "Usage: " << executable << " [--instances N] [--seed N] [--levels N] [--rows N] [--tasks N] [--models N] [--vehicles N] [--time-limit SECONDS]" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Read command line arguments into generator parameters and settings. Returns false for unknown or incomplete arguments. */
+bool parse_arguments(int argc, char *argv[], Generator_parameters &parameters) {
+    for (int i = 1; i < argc; ++i) {
+        string argument(argv[i]);
+        if (i + 1 == argc) {
+            cout << "WARNING: Missing value of argument " << argument << endl;
+            return false;
+        }
+        string value(argv[++i]);
+        if (argument == "--instances")
+            INSTANCES = stoi(value);
+        else if (argument == "--seed")
+            FIRST_SEED = stoi(value);
+        else if (argument == "--levels")
+            parameters.Levels = stoi(value);
+        else if (argument == "--rows")
+            parameters.Rows = stoi(value);
+        else if (argument == "--tasks")
+            parameters.Tasks = stoi(value);
+        else if (argument == "--models")
+            parameters.Models = stoi(value);
+        else if (argument == "--vehicles")
+            parameters.Vehicles = stoi(value);
+        else if (argument == "--time-limit")
+            TIME_LIMIT = stod(value);
+        else {
+            cout << "WARNING: Unknown argument " << argument << endl;
+            return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+    // small instances: the reference path solves them to optimality within seconds
+    Generator_parameters parameters(default_generator_parameters());
+    parameters.Levels = 2;
+    parameters.Tasks = 8;
+    parameters.Vehicles = 6;
+    if (!parse_arguments(argc, argv, parameters)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!check_generator_parameters(parameters))
+        return 1;
+    Differential_report report = {0, 0, 0};
+    for (int i = 0; i != INSTANCES; ++i) {
+        parameters.Seed = FIRST_SEED + i;
+        Generated_instance instance;
+        generate_instance(instance, parameters);
+        string name(generated_instance_name(parameters));
+        string filename(name + ".csv");
+        if (!write_instance(instance, "Data/Instances_csv/" + filename)) {
+            cout << "WARNING: Instance " << filename << " could not be written!" << endl;
+            return 1;
+        }
+        int number_vehicles(parameters.Vehicles);
+        int number_locations, number_tasks, number_models, cycle_time, total_workload;
+        Location start_loc, end_loc;
+        vector<Model> models;
+        vector<Vehicle> vehicles;
+        vector<Location> locations;
+        vector<VecI> transportation_times;
+        if (!read_instance(filename, number_models, number_vehicles, number_locations, number_tasks,
+                           models, vehicles, locations, cycle_time, start_loc, end_loc, transportation_times, total_workload)) {
+            report_check(report, false, name + ": instance could not be read");
+            continue;
+        }
+        preprocess(models, locations, number_locations, number_tasks, start_loc, end_loc);
+        int ub(-1);
+        generate_initial_solution(models, vehicles, locations, transportation_times, number_locations, ub);
+        int horizon(vehicles.back().Arrival_time + ub);
+        for (int scenario = 0; scenario != 4; ++scenario) {
+            vector<Model> scenario_models(models);
+            string string_scenario("ERROR");
+            initialize_models_for_scenario(scenario_models, locations, number_locations, scenario, string_scenario);
+            string context(name + " " + string_scenario);
+            // pricing on root node
+            vector<Vehicle> scenario_vehicles(vehicles);
+            vector<vector<VecI>> fixed_vlt;
+            vector<vector<VecI>> enforced_vlz;
+            vector<vector<VecI>> forbidden_vlz;
+            vector<VecI> start_lb, start_ub;
+            root_node(fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, scenario_models, scenario_vehicles, locations, number_locations, number_tasks, horizon);
+            Node root;
+            initialize_root_node(root, fixed_vlt, enforced_vlz, forbidden_vlz, start_lb, start_ub, scenario_models, scenario_vehicles);
+            determine_available_combinations(scenario_models, scenario_vehicles, locations, root, number_tasks, number_locations);
+            VecD no_cut_cost;
+            vector<vector<VecI>> no_zero_half_cuts;
+            for (int round = 0; round != DUAL_ROUNDS; ++round) {
+                vector<VecD> block_cost;
+                int dual_seed(parameters.Seed * DUAL_ROUNDS + round);
+                generate_synthetic_duals(block_cost, scenario_models, scenario_vehicles, number_locations, horizon, dual_seed, BLOCK_DENSITY, BLOCK_SCALE,
+                                         MAX_COST_SLACK);
+                compare_pricing(report, context + " duals " + to_string(round), PRICING_ENGINES, PULSE_LABELS, scenario_models, scenario_vehicles,
+                                locations, block_cost, no_cut_cost, no_zero_half_cuts, transportation_times, number_locations, number_tasks, root, ub, horizon);
+            }
+            // pricing on nodes with random branching decisions and zero-half cuts
+            mt19937 generator((unsigned) (parameters.Seed * 4 + scenario));
+            for (int n = 0; n != BRANCHED_NODES; ++n) {
+                Node node(root);
+                node.Id = n + 1;
+                node.Depth = BRANCHING_DEPTH;
+                apply_random_branching_decisions(node, BRANCHING_DEPTH, generator, scenario_models, scenario_vehicles, locations, number_locations,
+                                                 number_tasks, horizon);
+                vector<Vehicle> node_vehicles(scenario_vehicles);
+                determine_available_combinations(scenario_models, node_vehicles, locations, node, number_tasks, number_locations);
+                vector<VecD> block_cost;
+                VecD cut_cost;
+                vector<vector<VecI>> zero_half_cuts;
+                int dual_seed(parameters.Seed * BRANCHED_NODES + n);
+                generate_synthetic_duals(block_cost, scenario_models, node_vehicles, number_locations, horizon, dual_seed, BLOCK_DENSITY, BLOCK_SCALE,
+                                         MAX_COST_SLACK);
+                generate_synthetic_cuts(cut_cost, zero_half_cuts, node_vehicles, number_locations, horizon, dual_seed, CUTS, CUT_SIZE, CUT_SCALE);
+                compare_pricing(report, context + " node " + to_string(n + 1), PRICING_ENGINES, PULSE_LABELS, scenario_models, node_vehicles,
+                                locations, block_cost, cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, node, ub, horizon);
+            }
+#ifdef WITH_GUROBI
+            // optimal sct
+            compare_optimal_sct(report, context, scenario, scenario_models, vehicles, locations, transportation_times, number_locations, number_tasks, ub);
+#endif
+        }
+    }
+    cout << "Checks: " << report.Checks << ", failed: " << report.Failures << ", skipped: " << report.Skipped << endl;
+    return report.Failures > 0 ? 1 : 0;
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Differential checks of candidate engines against the reference path on the same instance.
+ * Pricing: the reference labeling algorithm (find_new_routes) and the candidate engines price every vehicle with the
+ * same duals, at the root node and at nodes derived by random branching decisions. Every generated route has to be
+ * feasible in the instance, the scenario, and the node, its reported cost has to be the cost recomputed from its tuples
+ * (including zero-half cuts), and its reduced cost has to be negative; the most negative reduced cost of a candidate
+ * has to be the one of the reference (all engines are exact).
+ * Solutions: the routes of a solution have to be feasible, must not block an inner location at the same time, and
+ * have to reach the reported sct. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Differential_report {
+    int Checks; // number of checks
+    int Failures; // number of failed checks
+    int Skipped; // comparisons without result (time limit reached)
+};
+//------------------------------------------------------------------------------------------------------------//
+void report_check(Differential_report &report, bool passed, string message) {
+    ++report.Checks;
+    if (!passed) {
+        ++report.Failures;
+        cout << "FAILED: " << message << endl;
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Cost of route in pricing recomputed from its tuples: sct dual times route duration, positive block costs while
+ * activities are performed at inner locations, and the costs of zero-half cuts whose location-times are visited twice. */
+double route_pricing_cost(vector<VecI> &route, Vehicle &vehicle, Model &model, vector<VecD> &block_cost, VecD &cut_cost,
+        vector<vector<VecI>> &zero_half_cuts, int &number_locations) {
+    double cost(vehicle.Sct_cost * (route.back()[2] - vehicle.Arrival_time));
+    VecI visits(zero_half_cuts.size(), 0);
+    for (auto x_it = route.begin(); x_it != route.end(); ++x_it) {
+        int l((*x_it)[0]);
+        if (l == 0 || l == number_locations - 1)
+            continue;
+        int start_time((*x_it)[2]);
+        int end_time(start_time + model.Possible_task_location_combination_workloads[l][(*x_it)[1]]);
+        for (int z = start_time; z != end_time; ++z) {
+            if (block_cost[l][z] > 0)
+                cost += block_cost[l][z];
+        }
+        for (size_t zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
+            for (auto c = zero_half_cuts[zhc].begin(); c != zero_half_cuts[zhc].end(); ++c) {
+                if ((*c)[0] == l && start_time <= (*c)[1] && end_time > (*c)[1])
+                    ++visits[zhc];
+            }
+        }
+    }
+    for (size_t zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
+        if (visits[zhc] >= 2)
+            cost += cut_cost[zhc];
+    }
+    return cost;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check if route respects the scenario: its task-location combinations are available in the scenario and each task is
+ * performed after (or together with) its predecessors in the scenario. */
+bool route_is_feasible_in_scenario(vector<VecI> &route, Model &model, int &number_tasks) {
+    VecI performed_at(number_tasks, -1);
+    for (size_t i = 0; i != route.size(); ++i) {
+        int l(route[i][0]), c(route[i][1]);
+        if (find(model.Scenario_task_location_combinations[l].begin(), model.Scenario_task_location_combinations[l].end(), c) == model.Scenario_task_location_combinations[l].end())
+            return false;
+        for (auto t_it = model.Possible_task_location_combinations_list[l][c].begin(); t_it != model.Possible_task_location_combinations_list[l][c].end(); ++t_it) {
+            performed_at[(*t_it)] = (int) i;
+        }
+    }
+    for (int t = 0; t != number_tasks; ++t) {
+        if (performed_at[t] == -1)
+            continue;
+        for (int p = 0; p != number_tasks; ++p) {
+            if (model.Tasks_per_model[p] && model.Scenario_all_predecessors[t][p] && (performed_at[p] == -1 || performed_at[p] > performed_at[t]))
+                return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Most negative reduced cost of routes (0 without routes). */
+double best_reduced_cost(VecD &routes_cost, Vehicle &vehicle) {
+    double best(0.0);
+    for (auto it = routes_cost.begin(); it != routes_cost.end(); ++it) {
+        best = min(best, (*it) - vehicle.Max_cost);
+    }
+    return best;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check feasibility (also in node), cost, and reduced cost of the routes generated by an engine. */
+void check_priced_routes(Differential_report &report, string context, vector<vector<VecI>> &routes, VecD &routes_cost, Vehicle &vehicle, Model &model,
+        vector<Location> &locations, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times,
+        int &number_locations, int &number_tasks, Node &node, int &ub, int &horizon) {
+    for (size_t r = 0; r != routes.size(); ++r) {
+        string route_context(context + " route " + to_string(r));
+        VecI start_times, end_times;
+        route_location_times(start_times, end_times, routes[r], model, number_locations);
+        bool feasible(validate_route(routes[r], vehicle, model, locations, transportation_times, number_locations, number_tasks, horizon)
+                      && route_is_feasible_in_scenario(routes[r], model, number_tasks) && routes[r].back()[2] - vehicle.Arrival_time < ub
+                      && route_is_feasible_in_node(routes[r], start_times, end_times, vehicle, model, locations, node, number_tasks));
+        report_check(report, feasible, route_context + ": infeasible route");
+        if (!feasible)
+            continue;
+        double cost(route_pricing_cost(routes[r], vehicle, model, block_cost, cut_cost, zero_half_cuts, number_locations));
+        report_check(report, fabs(cost - routes_cost[r]) <= PRECISION,
+                     route_context + ": reported cost " + to_string(routes_cost[r]) + ", recomputed cost " + to_string(cost));
+        report_check(report, routes_cost[r] < vehicle.Max_cost - PRECISION,
+                     route_context + ": reduced cost " + to_string(routes_cost[r] - vehicle.Max_cost) + " is not negative");
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Price every vehicle with the reference labeling algorithm and the candidate engines (see price_vehicle) in node. */
+void compare_pricing(Differential_report &report, string context, VecS &engines, int &max_labels, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times,
+        int &number_locations, int &number_tasks, Node &node, int &ub, int &horizon) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        Model &model(models[(*v_it).Type]);
+        string vehicle_context(context + " vehicle " + to_string((*v_it).Id));
+        vector<vector<VecI>> reference_routes;
+        VecD reference_routes_cost;
+        double rc_limit(0.0);
+        bool enumerate(false);
+        int route_limit(0);
+        atomic<bool> stop(false);
+        Pricing_statistics statistics = {};
+        find_new_routes(reference_routes, reference_routes_cost, (*v_it).Id, (*v_it), model, locations, block_cost, cut_cost, zero_half_cuts,
+                        transportation_times, number_locations, number_tasks, node, ub, horizon, rc_limit, enumerate, route_limit, stop, statistics);
+        check_priced_routes(report, vehicle_context + " LABELING", reference_routes, reference_routes_cost, (*v_it), model, locations, block_cost,
+                            cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, node, ub, horizon);
+        double reference_best(best_reduced_cost(reference_routes_cost, (*v_it)));
+        for (auto e_it = engines.begin(); e_it != engines.end(); ++e_it) {
+            vector<vector<VecI>> routes;
+            VecD routes_cost;
+            price_vehicle((*e_it), max_labels, routes, routes_cost, (*v_it).Id, (*v_it), model, locations, block_cost, cut_cost, zero_half_cuts,
+                          transportation_times, number_locations, number_tasks, node, ub, horizon, statistics);
+            check_priced_routes(report, vehicle_context + " " + (*e_it), routes, routes_cost, (*v_it), model, locations, block_cost,
+                                cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, node, ub, horizon);
+            double best(best_reduced_cost(routes_cost, (*v_it)));
+            report_check(report, fabs(best - reference_best) <= PRECISION,
+                         vehicle_context + " " + (*e_it) + ": most negative reduced cost " + to_string(best) + ", reference " + to_string(reference_best));
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Apply depth random branching decisions (families ASSIGN, USAGE, and TIME with random direction) to node. */
+void apply_random_branching_decisions(Node &node, int &depth, mt19937 &generator, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, int &number_locations, int &number_tasks, int &horizon) {
+    uniform_int_distribution<int> family(0, 2);
+    uniform_int_distribution<int> direction(0, 1);
+    uniform_int_distribution<int> vehicle(0, (int) vehicles.size() - 1);
+    uniform_int_distribution<int> location(1, max(1, number_locations - 2));
+    for (int d = 0; d != depth; ++d) {
+        Branching_decision decision;
+        decision.Family = family(generator);
+        decision.Direction = direction(generator);
+        decision.Vehicle = vehicle(generator);
+        Vehicle &branched_vehicle(vehicles[decision.Vehicle]);
+        Model &model(models[branched_vehicle.Type]);
+        uniform_int_distribution<int> time(branched_vehicle.Arrival_time, max(branched_vehicle.Arrival_time, horizon - 1));
+        VecI tasks;
+        if (decision.Family == 1) {
+            decision.Index = location(generator);
+            decision.Value = time(generator);
+        }
+        else {
+            if (decision.Family == 0)
+                decision.Index = location(generator);
+            // the dummy start and end tasks are not branched on (see find_branching_candidates)
+            for (int t = 1; t < number_tasks - 1; ++t) {
+                if (model.Tasks_per_model[t] && (decision.Family == 2 || locations[decision.Index].Assignments[t]))
+                    tasks.push_back(t);
+            }
+            if (tasks.empty())
+                continue;
+            int task(tasks[uniform_int_distribution<int>(0, (int) tasks.size() - 1)(generator)]);
+            if (decision.Family == 0) {
+                decision.Value = task;
+            }
+            else {
+                decision.Index = task;
+                decision.Value = time(generator);
+            }
+        }
+        apply_branching_decision(node, decision, vehicles, locations);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check solution (route index per vehicle): feasible routes, no vehicles at an inner location at the same time, and sct. */
+void check_solution(Differential_report &report, string context, VecI &solution, int &sct, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<VecI> &transportation_times, int &number_locations, int &number_tasks, int &horizon) {
+    if (solution.size() != vehicles.size()) {
+        report_check(report, false, context + ": solution has " + to_string(solution.size()) + " routes for " + to_string(vehicles.size()) + " vehicles");
+        return;
+    }
+    int solution_sct(0);
+    vector<vector<VecI>> occupied(number_locations); // (start, end, vehicle) of activities at inner locations
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        Model &model(models[(*v_it).Type]);
+        int r(solution[(*v_it).Id]);
+        if (r < 0 || r >= (int) (*v_it).Route_details.size()) {
+            report_check(report, false, context + ": route " + to_string(r) + " of vehicle " + to_string((*v_it).Id) + " does not exist");
+            return;
+        }
+        vector<VecI> &route((*v_it).Route_details[r]);
+        bool feasible(validate_route(route, (*v_it), model, locations, transportation_times, number_locations, number_tasks, horizon)
+                      && route_is_feasible_in_scenario(route, model, number_tasks));
+        report_check(report, feasible, context + ": infeasible route of vehicle " + to_string((*v_it).Id));
+        if (!feasible)
+            return;
+        solution_sct = max(solution_sct, route.back()[2] - (*v_it).Arrival_time);
+        for (auto x_it = route.begin(); x_it != route.end(); ++x_it) {
+            if ((*x_it)[0] == 0 || (*x_it)[0] == number_locations - 1)
+                continue;
+            occupied[(*x_it)[0]].push_back({(*x_it)[2], (*x_it)[2] + model.Possible_task_location_combination_workloads[(*x_it)[0]][(*x_it)[1]], (*v_it).Id});
+        }
+    }
+    bool conflict_free(true);
+    for (int l = 1; l < number_locations - 1 && conflict_free; ++l) {
+        sort(occupied[l].begin(), occupied[l].end());
+        for (size_t i = 1; i < occupied[l].size(); ++i) {
+            if (occupied[l][i][0] < occupied[l][i - 1][1]) {
+                report_check(report, false, context + ": vehicles " + to_string(occupied[l][i - 1][2]) + " and " + to_string(occupied[l][i][2])
+                                            + " block location " + to_string(l) + " at the same time");
+                conflict_free = false;
+                break;
+            }
+        }
+    }
+    if (conflict_free)
+        report_check(report, true, context);
+    report_check(report, solution_sct == sct, context + ": routes reach sct " + to_string(solution_sct) + ", reported " + to_string(sct));
+}
+//------------------------------------------------------------------------------------------------------------//
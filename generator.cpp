@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------------------------------------//
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <random>
+#include <cstdlib>
+#include <math.h>
+#include "instance_list.hpp"
+#include "instance_generator.hpp"
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* Generator of synthetic instances (see instance_generator.hpp). Writes one instance per seed to the instance directory
+ * and prints its name, which can be passed to the solver and the benchmark with --instance (together with --vehicles if
+ * the instances have fewer than NUMBER_VEHICLES vehicles). */
+//------------------------------------------------------------------------------------------------------------//
+// Settings
+string INSTANCE_DIRECTORY("Data/Instances_csv/"); // directory of instances read by read_instance (command line: --output)
+int INSTANCE_COUNT(1); // number of instances with consecutive seeds (command line: --count)
+//------------------------------------------------------------------------------------------------------------//
+void print_usage(string executable) {
+    cout << "Usage: " << executable << " [--levels N] [--rows N] [--tasks N] [--models N] [--vehicles N] [--seed N] [--count N]"
+         << " [--min-task-time N] [--max-task-time N] [--task-share P] [--precedence-density P] [--precedence-window N]"
+         << " [--flexibility P] [--max-tasks-per-location N] [--level-travel-time N] [--row-travel-time N] [--output DIRECTORY]" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Read command line arguments into parameters. Returns false for unknown or incomplete arguments. */
+bool parse_arguments(int argc, char *argv[], Generator_parameters &parameters) {
+    for (int i = 1; i < argc; ++i) {
+        string argument(argv[i]);
+        if (i + 1 == argc) {
+            cout << "WARNING: Missing value of argument " << argument << endl;
+            return false;
+        }
+        string value(argv[++i]);
+        if (argument == "--levels")
+            parameters.Levels = stoi(value);
+        else if (argument == "--rows")
+            parameters.Rows = stoi(value);
+        else if (argument == "--tasks")
+            parameters.Tasks = stoi(value);
+        else if (argument == "--models")
+            parameters.Models = stoi(value);
+        else if (argument == "--vehicles")
+            parameters.Vehicles = stoi(value);
+        else if (argument == "--seed")
+            parameters.Seed = stoi(value);
+        else if (argument == "--count")
+            INSTANCE_COUNT = stoi(value);
+        else if (argument == "--min-task-time")
+            parameters.Min_task_time = stoi(value);
+        else if (argument == "--max-task-time")
+            parameters.Max_task_time = stoi(value);
+        else if (argument == "--task-share")
+            parameters.Task_share = stod(value);
+        else if (argument == "--precedence-density")
+            parameters.Precedence_density = stod(value);
+        else if (argument == "--precedence-window")
+            parameters.Precedence_window = stoi(value);
+        else if (argument == "--flexibility")
+            parameters.Assignment_flexibility = stod(value);
+        else if (argument == "--max-tasks-per-location")
+            parameters.Max_tasks_per_location = stoi(value);
+        else if (argument == "--level-travel-time")
+            parameters.Level_travel_time = stoi(value);
+        else if (argument == "--row-travel-time")
+            parameters.Row_travel_time = stoi(value);
+        else if (argument == "--output")
+            INSTANCE_DIRECTORY = value + "/";
+        else {
+            cout << "WARNING: Unknown argument " << argument << endl;
+            return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+    Generator_parameters parameters(default_generator_parameters());
+    if (!parse_arguments(argc, argv, parameters)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (!check_generator_parameters(parameters))
+        return 1;
+    if (parameters.Vehicles < NUMBER_VEHICLES)
+        cout << "WARNING: The solver reads " << NUMBER_VEHICLES << " vehicles by default, pass --vehicles " << parameters.Vehicles << " to solve these instances" << endl;
+    int first_seed(parameters.Seed);
+    for (int i = 0; i != INSTANCE_COUNT; ++i) {
+        parameters.Seed = first_seed + i;
+        Generated_instance instance;
+        generate_instance(instance, parameters);
+        string name(generated_instance_name(parameters));
+        if (!write_instance(instance, INSTANCE_DIRECTORY + name + ".csv")) {
+            cout << "WARNING: Instance " << INSTANCE_DIRECTORY + name + ".csv" << " could not be written!" << endl;
+            return 1;
+        }
+        cout << name << endl;
+    }
+    return 0;
+}
+//------------------------------------------------------------------------------------------------------------//
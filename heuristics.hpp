@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Primal heuristics of branch-and-price to find better upper bounds. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* Restrict node to route r of vehicle: fix the route's task-location assignments and task start times. */
+void enforce_route(Node &node, Vehicle &vehicle, int &r, Model &model, int &number_locations, int &number_tasks) {
+    for (int l = 1; l != number_locations - 1; ++l) {
+        for (int t = 0; t != number_tasks; ++t) {
+            if (model.Tasks_per_model[t])
+                node.Fixed_vehicle_location_tasks[vehicle.Id][l][t] = 0;
+        }
+    }
+    for (auto x_it = vehicle.Route_details[r].begin(); x_it != vehicle.Route_details[r].end(); ++x_it) {
+        for (auto t_it = model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].begin(); t_it != model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].end(); ++t_it) {
+            if ((*x_it)[0] != 0 && (*x_it)[0] != number_locations - 1)
+                node.Fixed_vehicle_location_tasks[vehicle.Id][(*x_it)[0]][(*t_it)] = 1;
+            node.Task_start_times_lower_bounds[vehicle.Id][(*t_it)] = (*x_it)[2];
+            node.Task_start_times_upper_bounds[vehicle.Id][(*t_it)] = (*x_it)[2];
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Diving heuristic: starting from a solved node, repeatedly enforce the route with the largest fractional value and
+ * resolve the LP with a limited number of column generation iterations until it is integral. If the LP uses dummy
+ * routes or cannot improve ub, the enforced route becomes tabu and the next route is tried; if no route is left,
+ * the dive returns to the previous depth. The number of such backtracks is limited. */
+void dive(int &ub, int &ub_escape, VecI &best_sol, Node &start_node, double &start_lb, vector<VecD> &start_split_routes, vector<Model> &models,
+        vector<Vehicle> &vehicles, vector<Location> &locations, vector<vector<vector<VecI>>> &blockings, vector<VecI> &transportation_times,
+        int &number_tasks, int &number_locations, Search_settings &settings, Pricing_scheduler &scheduler, Time_point &start_scenario) {
+    vector<Node> path(1, start_node); // nodes of dive
+    vector<vector<VecD>> path_split_routes(1, start_split_routes); // split routes of nodes of dive
+    VecD path_lb(1, start_lb); // lower bounds of nodes of dive
+    vector<VecI> path_routes; // enforced routes {vehicle, route} that lead to nodes of dive
+    vector<VecI> tabu; // enforced routes {vehicle, route} that failed
+    int backtracks(0);
+    int start_ub(ub);
+    Search_settings dive_settings(node_heuristic_settings(settings, settings.Diving_iterations));
+    while (ub > ub_escape && elapsed_seconds(start_scenario) < settings.Time_limit) {
+        // select route with largest fractional value
+        VecI route;
+        double value(PRECISION);
+        for (size_t v = 0; v != path_split_routes.back().size(); ++v) {
+            for (size_t r = 0; r != path_split_routes.back()[v].size(); ++r) {
+                double split(path_split_routes.back()[v][r]);
+                if (split > value && split < 1 - PRECISION) {
+                    VecI candidate({(int) v, (int) r});
+                    if (find(tabu.begin(), tabu.end(), candidate) == tabu.end()) {
+                        route = candidate;
+                        value = split;
+                    }
+                }
+            }
+        }
+        if (route.empty()) {
+            // no route left at this depth: return to previous depth
+            if (path.size() == 1 || backtracks == settings.Diving_backtracks)
+                break;
+            ++backtracks;
+            tabu.push_back(path_routes.back());
+            path.pop_back();
+            path_split_routes.pop_back();
+            path_lb.pop_back();
+            path_routes.pop_back();
+            continue;
+        }
+        // enforce route and resolve LP
+        Node node(path.back());
+        enforce_route(node, vehicles[route[0]], route[1], models[vehicles[route[0]].Type], number_locations, number_tasks);
+        node.Lb = path_lb.back();
+        int horizon(vehicles.back().Arrival_time + ub);
+        double node_lb(ub);
+        bool node_is_integral(true);
+        bool node_is_feasible(true);
+        bool node_is_complete(true);
+        vector<VecD> node_split_routes;
+        vector<vector<VecD>> node_split_usage;
+        vector<vector<VecD>> node_split_tasks;
+        vector<vector<VecD>> node_split_times;
+        vector<VecI> node_fixings;
+        solve_node(horizon, ub, ub_escape, best_sol, node_lb, node_is_integral, node_is_feasible, node_is_complete, node_split_routes, node_split_usage, node_split_tasks, node_split_times,
+                node_fixings, node, models, vehicles, locations, blockings, transportation_times, number_tasks, number_locations, dive_settings, scheduler, start_scenario);
+        if ((node_is_feasible && node_is_integral) || !node_is_complete)
+            break;
+        if (!node_is_feasible || ub - node_lb < 1 - PRECISION) {
+            // enforced route fails: try next route at this depth
+            if (backtracks == settings.Diving_backtracks)
+                break;
+            ++backtracks;
+            tabu.push_back(route);
+            continue;
+        }
+        path.push_back(node);
+        path_split_routes.push_back(node_split_routes);
+        path_lb.push_back(node_lb);
+        path_routes.push_back(route);
+    }
+    if (ub < start_ub)
+        cout << "DIVING: " << ub << " (depth " << path.size() << ", backtracks " << backtracks << ")" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,327 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Synthetic instances for scaling studies, written as csv files in the format of read_instance.
+ * Layout: start location 0 (level 0), levels 1, ..., Levels with Rows locations each, and end location (level Levels + 1);
+ * transportation times are rectilinear in levels and rows. Task 0 (start) and the last task (end) are dummy tasks.
+ * Precedence graph: the inner tasks are numbered in topological order, a task precedes each of the next
+ * Precedence_window tasks with probability Precedence_density, and the dummy tasks precede (succeed) all tasks.
+ * Preselected line (NF): the inner tasks are split into contiguous blocks over the inner locations in the order of
+ * their ids; a task additionally can be performed at the previous and next location with probability
+ * Assignment_flexibility. The preselected line induces the implicit predecessors of the NF and RF scenarios.
+ * Every model requires a share of the inner tasks; precedence relations of a model are those of the full graph between
+ * its tasks. Vehicles arrive in intervals of the cycle time of the preselected line. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Generator_parameters {
+    int Levels; // number of levels of inner locations
+    int Rows; // number of inner locations per level
+    int Tasks; // number of inner tasks (without dummy tasks)
+    int Models; // number of models
+    int Vehicles; // number of vehicles
+    int Seed; // seed of random numbers
+    int Min_task_time; // minimum task time
+    int Max_task_time; // maximum task time
+    double Task_share; // probability that a model requires an inner task
+    double Precedence_density; // probability of a direct precedence relation between two tasks within the window
+    int Precedence_window; // maximum distance of directly related tasks in the topological order
+    double Assignment_flexibility; // probability that a task can be performed at a neighbouring location of the preselected line
+    int Max_tasks_per_location; // maximum number of tasks that can be performed at a location
+    int Level_travel_time; // transportation time between neighbouring levels
+    int Row_travel_time; // transportation time between neighbouring rows
+};
+//------------------------------------------------------------------------------------------------------------//
+struct Generated_instance {
+    int Number_locations; // number of locations (with start and end location)
+    int Number_tasks; // number of tasks (with dummy tasks)
+    int Cycle_time; // cycle time of the preselected line
+    int Total_workload; // workload of all vehicles
+    VecI Level_index; // level index of locations
+    VecI Row_index; // row index of locations
+    vector<VecI> Transportation_times; // transportation times between locations
+    VecI Block; // location of tasks in the preselected line
+    vector<VecB> Assignments; // 1 if task can be performed at location
+    vector<VecB> Successors; // explicit successors of the full precedence graph
+    vector<VecB> All_successors; // implicit successors of the full precedence graph
+    vector<VecB> Tasks_per_model; // required tasks of models
+    vector<VecI> Task_times; // task times of models
+    VecI Vehicle_types; // model of vehicles
+    VecI Arrival_times; // arrival times of vehicles
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Default parameters: a small line that is solved within seconds. */
+Generator_parameters default_generator_parameters() {
+    return {3, 2, 12, 2, NUMBER_VEHICLES, 0, 1, 5, 0.8, 0.3, 3, 0.3, 4, 1, 1};
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Returns false (with a warning) if the parameters do not describe an instance. */
+bool check_generator_parameters(Generator_parameters &parameters) {
+    if (parameters.Levels < 1 || parameters.Rows < 1 || parameters.Tasks < 1 || parameters.Models < 1 || parameters.Vehicles < 1) {
+        cout << "WARNING: Levels, rows, tasks, models, and vehicles have to be positive!" << endl;
+        return false;
+    }
+    if (parameters.Min_task_time < 1 || parameters.Max_task_time < parameters.Min_task_time) {
+        cout << "WARNING: Task times have to satisfy 1 <= minimum <= maximum!" << endl;
+        return false;
+    }
+    if (parameters.Max_tasks_per_location < (parameters.Tasks + parameters.Levels * parameters.Rows - 1) / (parameters.Levels * parameters.Rows)) {
+        cout << "WARNING: Preselected line needs more than " << parameters.Max_tasks_per_location << " tasks per location!" << endl;
+        return false;
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+string generated_instance_name(Generator_parameters &parameters) {
+    return "gen_" + to_string(parameters.Levels * parameters.Rows) + "_" + to_string(parameters.Tasks) + "_" + to_string(parameters.Models) + "_"
+           + to_string(parameters.Vehicles) + "_" + to_string(parameters.Seed);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Locations on levels and rows with rectilinear transportation times. */
+void generate_layout(Generated_instance &instance, Generator_parameters &parameters) {
+    instance.Number_locations = parameters.Levels * parameters.Rows + 2;
+    instance.Level_index = {0};
+    instance.Row_index = {0};
+    for (int level = 1; level <= parameters.Levels; ++level) {
+        for (int row = 1; row <= parameters.Rows; ++row) {
+            instance.Level_index.push_back(level);
+            instance.Row_index.push_back(row);
+        }
+    }
+    instance.Level_index.push_back(parameters.Levels + 1);
+    instance.Row_index.push_back(0);
+    instance.Transportation_times.assign(instance.Number_locations, VecI(instance.Number_locations, 0));
+    for (int l1 = 0; l1 != instance.Number_locations; ++l1) {
+        for (int l2 = 0; l2 != instance.Number_locations; ++l2) {
+            instance.Transportation_times[l1][l2] = parameters.Level_travel_time * abs(instance.Level_index[l1] - instance.Level_index[l2])
+                                                    + parameters.Row_travel_time * abs(instance.Row_index[l1] - instance.Row_index[l2]);
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Random precedence graph in topological order of the tasks and its transitive closure. */
+void generate_precedence_graph(Generated_instance &instance, Generator_parameters &parameters, mt19937 &generator) {
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    int number_tasks(instance.Number_tasks);
+    instance.Successors.assign(number_tasks, VecB(number_tasks, false));
+    for (int t1 = 1; t1 != number_tasks - 1; ++t1) {
+        instance.Successors[0][t1] = true;
+        instance.Successors[t1][number_tasks - 1] = true;
+        for (int t2 = t1 + 1; t2 != min(t1 + parameters.Precedence_window + 1, number_tasks - 1); ++t2) {
+            if (uniform(generator) < parameters.Precedence_density)
+                instance.Successors[t1][t2] = true;
+        }
+    }
+    instance.Successors[0][number_tasks - 1] = true;
+    // successors of t1 are the direct successors and their successors (tasks are in topological order)
+    instance.All_successors = instance.Successors;
+    for (int t1 = number_tasks - 1; t1 >= 0; --t1) {
+        for (int t2 = t1 + 1; t2 != number_tasks; ++t2) {
+            if (!instance.Successors[t1][t2])
+                continue;
+            for (int t3 = t2 + 1; t3 != number_tasks; ++t3) {
+                if (instance.All_successors[t2][t3])
+                    instance.All_successors[t1][t3] = true;
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Preselected line (contiguous blocks of tasks on the inner locations) and flexible task-location assignments. */
+void generate_assignments(Generated_instance &instance, Generator_parameters &parameters, mt19937 &generator) {
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    int number_tasks(instance.Number_tasks);
+    int inner_locations(instance.Number_locations - 2);
+    instance.Block.assign(number_tasks, 0);
+    instance.Block[number_tasks - 1] = instance.Number_locations - 1;
+    instance.Assignments.assign(instance.Number_locations, VecB(number_tasks, false));
+    instance.Assignments[0][0] = true;
+    instance.Assignments[instance.Number_locations - 1][number_tasks - 1] = true;
+    VecI assigned_tasks(instance.Number_locations, 0);
+    for (int t = 1; t != number_tasks - 1; ++t) {
+        instance.Block[t] = 1 + (t - 1) * inner_locations / parameters.Tasks;
+        instance.Assignments[instance.Block[t]][t] = true;
+        ++assigned_tasks[instance.Block[t]];
+    }
+    for (int t = 1; t != number_tasks - 1; ++t) {
+        for (int l = max(1, instance.Block[t] - 1); l <= min(inner_locations, instance.Block[t] + 1); ++l) {
+            if (instance.Assignments[l][t] || assigned_tasks[l] >= parameters.Max_tasks_per_location)
+                continue;
+            if (uniform(generator) < parameters.Assignment_flexibility) {
+                instance.Assignments[l][t] = true;
+                ++assigned_tasks[l];
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Required tasks and task times of models. */
+void generate_models(Generated_instance &instance, Generator_parameters &parameters, mt19937 &generator) {
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    uniform_int_distribution<int> task_time(parameters.Min_task_time, parameters.Max_task_time);
+    uniform_int_distribution<int> any_task(1, parameters.Tasks);
+    int number_tasks(instance.Number_tasks);
+    for (int m = 0; m != parameters.Models; ++m) {
+        VecB tasks(number_tasks, false);
+        VecI times(number_tasks, 0);
+        tasks[0] = true;
+        tasks[number_tasks - 1] = true;
+        bool inner_task(false);
+        for (int t = 1; t != number_tasks - 1; ++t) {
+            if (uniform(generator) < parameters.Task_share) {
+                tasks[t] = true;
+                inner_task = true;
+            }
+        }
+        if (!inner_task)
+            tasks[any_task(generator)] = true;
+        for (int t = 1; t != number_tasks - 1; ++t) {
+            if (tasks[t])
+                times[t] = task_time(generator);
+        }
+        instance.Tasks_per_model.push_back(tasks);
+        instance.Task_times.push_back(times);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Vehicle models and arrival times in intervals of the cycle time of the preselected line (its maximum workload at a location). */
+void generate_vehicles(Generated_instance &instance, Generator_parameters &parameters, mt19937 &generator) {
+    uniform_int_distribution<int> any_model(0, parameters.Models - 1);
+    instance.Cycle_time = 1;
+    for (int m = 0; m != parameters.Models; ++m) {
+        VecI workloads(instance.Number_locations, 0);
+        for (int t = 0; t != instance.Number_tasks; ++t) {
+            workloads[instance.Block[t]] += instance.Task_times[m][t];
+        }
+        instance.Cycle_time = max(instance.Cycle_time, *max_element(workloads.begin(), workloads.end()));
+    }
+    instance.Total_workload = 0;
+    for (int v = 0; v != parameters.Vehicles; ++v) {
+        instance.Vehicle_types.push_back(any_model(generator));
+        instance.Arrival_times.push_back(v * instance.Cycle_time);
+        for (int t = 0; t != instance.Number_tasks; ++t) {
+            instance.Total_workload += instance.Task_times[instance.Vehicle_types.back()][t];
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+void generate_instance(Generated_instance &instance, Generator_parameters &parameters) {
+    mt19937 generator((unsigned) parameters.Seed);
+    instance.Number_tasks = parameters.Tasks + 2;
+    generate_layout(instance, parameters);
+    generate_precedence_graph(instance, parameters, generator);
+    generate_assignments(instance, parameters, generator);
+    generate_models(instance, parameters, generator);
+    generate_vehicles(instance, parameters, generator);
+}
+//------------------------------------------------------------------------------------------------------------//
+void write_csv_row(ofstream &file, const VecI &values) {
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        file << (it == values.begin() ? "" : ";") << (*it);
+    }
+    file << "\n";
+}
+//------------------------------------------------------------------------------------------------------------//
+void write_csv_row(ofstream &file, const VecB &values) {
+    write_csv_row(file, VecI(values.begin(), values.end()));
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write instance in the format of read_instance (a header row precedes every block of data rows).
+ * Precedence relations of a model are restricted to its tasks; the implicit predecessors of the preselected line add
+ * the order of the locations of the line to the precedence graph. Returns false if the file cannot be written. */
+bool write_instance(Generated_instance &instance, string filename) {
+    ofstream file(filename, ios::trunc);
+    if (!file)
+        return false;
+    int number_tasks(instance.Number_tasks);
+    int number_models((int) instance.Tasks_per_model.size());
+    file << "number_locations;number_tasks;number_models\n";
+    write_csv_row(file, VecI({instance.Number_locations, number_tasks, number_models}));
+    file << "cycle_time;total_workload\n";
+    write_csv_row(file, VecI({instance.Cycle_time, instance.Total_workload}));
+    file << "vehicle_types\n";
+    write_csv_row(file, instance.Vehicle_types);
+    file << "arrival_times\n";
+    write_csv_row(file, instance.Arrival_times);
+    file << "start_location;end_location\n";
+    write_csv_row(file, VecI({0, instance.Number_locations - 1}));
+    file << "level_index;row_index\n";
+    for (int l = 0; l != instance.Number_locations; ++l) {
+        write_csv_row(file, VecI({instance.Level_index[l], instance.Row_index[l]}));
+    }
+    file << "transportation_times\n";
+    for (int l = 0; l != instance.Number_locations; ++l) {
+        write_csv_row(file, instance.Transportation_times[l]);
+    }
+    file << "tasks_per_model\n";
+    for (int m = 0; m != number_models; ++m) {
+        write_csv_row(file, instance.Tasks_per_model[m]);
+    }
+    file << "task_times\n";
+    for (int m = 0; m != number_models; ++m) {
+        write_csv_row(file, instance.Task_times[m]);
+    }
+    file << "assignments\n";
+    for (int l = 0; l != instance.Number_locations; ++l) {
+        write_csv_row(file, instance.Assignments[l]);
+    }
+    // precedence relations between the tasks of a model: explicit successors, implicit successors and predecessors
+    vector<vector<VecB>> successors, all_successors, all_predecessors, preselect_all_predecessors;
+    for (int m = 0; m != number_models; ++m) {
+        VecB &tasks(instance.Tasks_per_model[m]);
+        successors.push_back(vector<VecB>(number_tasks, VecB(number_tasks, false)));
+        all_successors.push_back(vector<VecB>(number_tasks, VecB(number_tasks, false)));
+        all_predecessors.push_back(vector<VecB>(number_tasks, VecB(number_tasks, false)));
+        preselect_all_predecessors.push_back(vector<VecB>(number_tasks, VecB(number_tasks, false)));
+        for (int t1 = 0; t1 != number_tasks; ++t1) {
+            for (int t2 = 0; t2 != number_tasks; ++t2) {
+                if (!tasks[t1] || !tasks[t2])
+                    continue;
+                successors[m][t1][t2] = instance.Successors[t1][t2];
+                all_successors[m][t1][t2] = instance.All_successors[t1][t2];
+                all_predecessors[m][t1][t2] = instance.All_successors[t2][t1];
+                preselect_all_predecessors[m][t1][t2] = instance.All_successors[t2][t1] || instance.Block[t2] < instance.Block[t1];
+            }
+        }
+    }
+    file << "successors\n";
+    for (int m = 0; m != number_models; ++m) {
+        for (int t = 0; t != number_tasks; ++t) {
+            write_csv_row(file, successors[m][t]);
+        }
+    }
+    file << "all_successors\n";
+    for (int m = 0; m != number_models; ++m) {
+        for (int t = 0; t != number_tasks; ++t) {
+            write_csv_row(file, all_successors[m][t]);
+        }
+    }
+    file << "all_predecessors\n";
+    for (int m = 0; m != number_models; ++m) {
+        for (int t = 0; t != number_tasks; ++t) {
+            write_csv_row(file, all_predecessors[m][t]);
+        }
+    }
+    file << "preselect_assignments\n";
+    for (int m = 0; m != number_models; ++m) {
+        for (int l = 0; l != instance.Number_locations; ++l) {
+            VecB preselected(number_tasks, false);
+            for (int t = 0; t != number_tasks; ++t) {
+                preselected[t] = instance.Tasks_per_model[m][t] && instance.Block[t] == l;
+            }
+            write_csv_row(file, preselected);
+        }
+    }
+    file << "preselect_all_predecessors\n";
+    for (int m = 0; m != number_models; ++m) {
+        for (int t = 0; t != number_tasks; ++t) {
+            write_csv_row(file, preselect_all_predecessors[m][t]);
+        }
+    }
+    return (bool) file;
+}
+//------------------------------------------------------------------------------------------------------------//
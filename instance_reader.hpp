@@ -86,8 +86,20 @@ vector<VecS> CSVReader::get_data() {
     return dataList;
 }
 //------------------------------------------------------------------------------------------------------------//
-/* Function to read csv data from file for given instance. */
-void read_instance(string &filename, int &number_models, int &number_vehicles, int &number_locations, int &number_tasks,
+/* Check if rows first_row, ..., first_row + rows - 1 of csv data exist and have at least columns entries. */
+bool csv_rows_exist(vector<VecS> &data, int first_row, int rows, int columns) {
+    if (first_row < 0 || (int) data.size() < first_row + rows)
+        return false;
+    for (int r = first_row; r != first_row + rows; ++r) {
+        if ((int) data[r].size() < columns)
+            return false;
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Function to read csv data from file for given instance. The first number_vehicles vehicles of the file are read.
+ * Returns false if the file has fewer vehicles or fewer rows or entries than its sizes require. */
+bool read_instance(string &filename, int &number_models, int &number_vehicles, int &number_locations, int &number_tasks,
         vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
         int &cycle_time, Location &start_loc, Location &end_loc, vector<VecI> &transportation_times, int &total_workload) {
     // creating an object of CSVReader
@@ -96,6 +108,10 @@ void read_instance(string &filename, int &number_models, int &number_vehicles, i
     // get the data from CSV File
     vector<VecS> data = reader.get_data();
     // read instance size
+    if (!csv_rows_exist(data, 1, 1, 3) || !csv_rows_exist(data, 3, 1, 2) || !csv_rows_exist(data, 9, 1, 2)) {
+        cout << "WARNING: Instance " << filename << " is incomplete!" << endl;
+        return false;
+    }
     number_models = stoi(data[1][2]);
     number_locations = stoi(data[1][0]);
     number_tasks = stoi(data[1][1]);
@@ -104,6 +120,23 @@ void read_instance(string &filename, int &number_models, int &number_vehicles, i
     total_workload = stoi(data[3][1]);
     int start_loc_id = stoi(data[9][0]);
     int end_loc_id = stoi(data[9][1]);
+    if (!csv_rows_exist(data, 5, 1, number_vehicles) || !csv_rows_exist(data, 7, 1, number_vehicles)) {
+        cout << "WARNING: Instance " << filename << " has fewer than " << number_vehicles << " vehicles!" << endl;
+        return false;
+    }
+    // blocks of rows and entries per row: locations, transportation times, tasks per model, task times, assignments,
+    // successors, implicit successors, implicit predecessors, preselect assignments, and preselect predecessors
+    vector<VecI> blocks({{number_locations, 2}, {number_locations, number_locations}, {number_models, number_tasks}, {number_models, number_tasks},
+                         {number_locations, number_tasks}, {number_models * number_tasks, number_tasks}, {number_models * number_tasks, number_tasks},
+                         {number_models * number_tasks, number_tasks}, {number_models * number_locations, number_tasks}, {number_models * number_tasks, number_tasks}});
+    int first_row(11);
+    for (auto b_it = blocks.begin(); b_it != blocks.end(); ++b_it) {
+        if (!csv_rows_exist(data, first_row, (*b_it)[0], (*b_it)[1])) {
+            cout << "WARNING: Instance " << filename << " is incomplete!" << endl;
+            return false;
+        }
+        first_row += (*b_it)[0] + 1;
+    }
     // define models
     for (int m = 0; m != number_models; ++m) {
         Model mod;
@@ -116,6 +149,10 @@ void read_instance(string &filename, int &number_models, int &number_vehicles, i
         veh.Id = v;
         veh.Arrival_time = stoi(data[7][v]);
         veh.Type = stoi(data[5][v]);
+        if (veh.Type < 0 || veh.Type >= number_models) {
+            cout << "WARNING: Vehicle " << v << " of instance " << filename << " has unknown model " << veh.Type << "!" << endl;
+            return false;
+        }
         vehicles.push_back(veh);
     }
     // define locations
@@ -268,5 +305,6 @@ void read_instance(string &filename, int &number_models, int &number_vehicles, i
         }
     }
     cout << "Instance " <<  filename << " includes " << number_locations - 2 << " locations, " << number_tasks - 2 << " tasks and " << number_vehicles << " vehicles." << endl;
+    return true;
 }
 //------------------------------------------------------------------------------------------------------------//
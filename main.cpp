@@ -4,10 +4,39 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <map>
+#include <set>
+#include <memory>
 #include <boost/algorithm/string.hpp>
 #include <ctime>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <future>
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <type_traits>
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sched.h>
+#include <sys/wait.h>
+#endif
+#if defined(PROFILING) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(PROFILING) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
 #include "gurobi_c++.h"
 #include <math.h>
+#include "timer.hpp"
+#include "profiler.hpp"
+#include "telemetry.hpp"
 #include "instance_list.hpp"
 #include "instance_reader.hpp"
 #include "preprocessing.hpp"
@@ -15,12 +44,22 @@
 #include "initial_solution.hpp"
 #include "mip_ub_solver.hpp"
 #include "route_finder.hpp"
+#include "pricer.hpp"
 #include "master_problem.hpp"
 #include "aux_node.hpp"
+#include "pricing_scheduler.hpp"
+#include "memory_accounting.hpp"
+#include "search_settings.hpp"
 #include "node_solver.hpp"
+#include "node_queue.hpp"
 #include "branching.hpp"
+#include "checkpoint.hpp"
+#include "column_cache.hpp"
+#include "heuristics.hpp"
+#include "scenario_bounds.hpp"
 #include "bandp.hpp"
 #include "output_writer.hpp"
+#include "batch_runner.hpp"
 using namespace std;
 //------------------------------------------------------------------------------------------------------------//
 // type definitions
@@ -33,18 +72,186 @@ bool MIP_NF_SOLVE(true); // solve NF scenario using time-continuous MIP
 bool MIP_OF_SOLVE(true); // solve OF scenario using time-continuous MIP
 bool MASTER_ACTIVITY_END(true); // master problem: blocking constraints only at end of activities
 bool USE_ALGORITHMIC_FRAMEWORK(true); // activate algorithmic framework
-int MAX_ROUTES_PER_VEHICLE(50); // limit the maximum number of added routes per vehicle in each column generation iterations (the routes with the most negative reduced cost are chosen)
+string THRESHOLD_SEARCH("INCREMENT"); // threshold search: INCREMENT (lower bound + 1), GALLOP (doubling steps, bisection after first solution), or BISECTION
+int MAX_ROUTES_PER_VEHICLE(50); // limit the maximum number of added routes per vehicle in each column generation iterations (the routes are chosen by COLUMN_SELECTION)
+string COLUMN_SELECTION("MOST_NEGATIVE"); // selection of added routes per vehicle: MOST_NEGATIVE (most negative reduced cost), DIVERSE (coverage of location-time cells), or MIXED (half each)
+bool COLUMN_TRANSFER(false); // offer time-shifted copies of new routes to the other vehicles of the same model
+string PRICING_ENGINE("LABELING"); // pricing algorithm: LABELING, PULSE (depth-first search with bound pruning), or RACE (both on separate threads, first result is used)
+int PULSE_LABELS(50); // pulse search: maximum number of explored route fragments kept per location for dominance pruning
+int PRICING_VEHICLES(5); // initial number of vehicles with new routes after which a pricing round stops (adapted to the share of priced vehicles with new routes)
+int PRICING_SEED(0); // seed of random tie breaking in the pricing order of vehicles
+bool ASYNC_PRICING(false); // price the vehicles not reached by a pricing round on its duals while the master problem is re-optimized
 VecS BRANCHING{"ASSIGN", "TIME", "USAGE"}; // define sequence of branching choices
+string BRANCHING_RULE("ORDER"); // branching variable selection: ORDER (first candidate in BRANCHING sequence), PSEUDOCOST, or STRONG
+int STRONG_BRANCHING_CANDIDATES(5); // STRONG: number of candidates with the highest pseudo-cost scores that are evaluated
+int STRONG_BRANCHING_ITERATIONS(10); // STRONG: maximum number of column generation iterations to evaluate a child node
+bool REDUCED_COST_FIXING(false); // remove task-location combinations from the subtree of a node if their reduced cost exceeds the gap
+int MIP_SEARCH_FREQUENCY(0); // solve restricted master MIP over the column pool at the root node and every n-th node of B&B tree (0: never)
+double MIP_SEARCH_TIME_LIMIT(10.0); // time limit of restricted master MIP
+double ROUTE_MIP_TIME_LIMIT(0.0); // time limit of time-continuous MIP at nodes whose routes are integral without timings (0: never)
+double ENUMERATION_GAP(0.0); // solve nodes with gap ub - lb <= n by route enumeration and MIP instead of branching (0: never)
+int ENUMERATION_ROUTES(20000); // maximum number of enumerated routes per vehicle (more routes: node is branched)
+double ENUMERATION_TIME_LIMIT(30.0); // time limit of MIP over enumerated routes
+int DIVING_FREQUENCY(0); // start diving heuristic at the root node and every n-th node of B&B tree (0: never)
+int DIVING_ITERATIONS(5); // maximum number of column generation iterations per diving step
+int DIVING_BACKTRACKS(3); // maximum number of backtracks per dive
+string NODE_SELECTION("DEPTH"); // node selection rule in B&B tree: DEPTH (depth-first, ties broken by branching preference), BEST_BOUND, or HYBRID
+int BEST_BOUND_FREQUENCY(10); // HYBRID node selection: every n-th node is the open node with the lowest lower bound
+int THREADS(1); // number of worker threads in branch-and-price tree search (each worker solves nodes on a private copy of the column pool)
 double TIME_LIMIT(3600.0); // time limit for solving a scenario
+double CHECKPOINT_INTERVAL(0.0); // write a checkpoint of the threshold search every n seconds and at the time limit to Results/Checkpoints (0: never)
+bool COLUMN_CACHE(false); // load the column pool of a scenario from Results/Columns at start and store it at the end
+bool RESUME(false); // resume scenarios from their checkpoints (finished scenarios are not solved again)
+bool CONCURRENT_SCENARIOS(false); // solve the scenarios of an instance concurrently on separate threads (each on a private copy of the column pool)
+int BATCH_WORKERS(0); // number of worker processes that solve the instances (0: solve instances in this process; command line: --batch)
+int BATCH_CORES(0); // number of cores per worker process (0: no restriction; command line: --cores)
+double MEMORY_LIMIT(0.0); // memory cap per process in GB (0: no limit; command line: --memory-limit)
+bool TELEMETRY(false); // write JSON lines records of every node and column generation iteration to Results/Telemetry/<instance>.jsonl
 //-----------------------------------------------------------------------------------------------------------//
-int main() {
-    for (auto instance_it = INSTANCE_LIST.begin(); instance_it != INSTANCE_LIST.end(); ++instance_it) {
+/* Settings of the threshold search of a scenario with checkpoint file. */
+Search_settings search_settings(string &checkpoint_file) {
+    Search_settings settings;
+    settings.Time_limit = TIME_LIMIT;
+    settings.Master_activity_end = MASTER_ACTIVITY_END;
+    settings.Branching = BRANCHING;
+    settings.Max_routes_per_vehicle = MAX_ROUTES_PER_VEHICLE;
+    settings.Node_selection = NODE_SELECTION;
+    settings.Best_bound_frequency = BEST_BOUND_FREQUENCY;
+    settings.Threads = THREADS;
+    settings.Branching_rule = BRANCHING_RULE;
+    settings.Strong_branching_candidates = STRONG_BRANCHING_CANDIDATES;
+    settings.Strong_branching_iterations = STRONG_BRANCHING_ITERATIONS;
+    settings.Reduced_cost_fixing = REDUCED_COST_FIXING;
+    settings.Mip_search_frequency = MIP_SEARCH_FREQUENCY;
+    settings.Mip_search_time_limit = MIP_SEARCH_TIME_LIMIT;
+    settings.Route_mip_time_limit = ROUTE_MIP_TIME_LIMIT;
+    settings.Enumeration_gap = ENUMERATION_GAP;
+    settings.Enumeration_routes = ENUMERATION_ROUTES;
+    settings.Enumeration_time_limit = ENUMERATION_TIME_LIMIT;
+    settings.Diving_frequency = DIVING_FREQUENCY;
+    settings.Diving_iterations = DIVING_ITERATIONS;
+    settings.Diving_backtracks = DIVING_BACKTRACKS;
+    settings.Pricing_seed = PRICING_SEED;
+    settings.Pricing_vehicles = PRICING_VEHICLES;
+    settings.Async_pricing = ASYNC_PRICING;
+    settings.Column_selection = COLUMN_SELECTION;
+    settings.Column_transfer = COLUMN_TRANSFER;
+    settings.Pricing_engine = PRICING_ENGINE;
+    settings.Pulse_labels = PULSE_LABELS;
+    settings.Use_root_bound = USE_ALGORITHMIC_FRAMEWORK;
+    settings.Threshold_search = THRESHOLD_SEARCH;
+    settings.Checkpoint_interval = CHECKPOINT_INTERVAL;
+    settings.Checkpoint_file = checkpoint_file;
+    settings.Resume = RESUME;
+    return settings;
+}
+//-----------------------------------------------------------------------------------------------------------//
+/* Solve scenario (0: NF, 1: OF, 2: RF, 3: FF) of instance and share its bounds with the other scenarios. */
+void solve_scenario(int scenario, string instance, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<VecI> &transportation_times, vector<vector<vector<VecI>>> &blockings, int &number_locations, int &number_tasks,
+        uint64_t &key, Scenario_bounds &bounds, int &sol_sct, VecI &sol_routes, int &scenario_horizon, double &sol_time, int &iterations) {
+    Time_point start_scenario = wall_clock();
+    string string_scenario("ERROR");
+    initialize_models_for_scenario(models, locations, number_locations, scenario, string_scenario);
+    string checkpoint_file("Results/Checkpoints/" + instance + "_" + string_scenario + ".bin");
+    telemetry_run() = instance + "_" + string_scenario;
+    Search_checkpoint checkpoint;
+    if (RESUME && checkpoint_is_finished(checkpoint_file, key)
+        && read_checkpoint(checkpoint_file, key, checkpoint, models, vehicles, locations, transportation_times, blockings, number_locations, number_tasks)) {
+        // scenario was solved before: take result from checkpoint
+        sol_sct = checkpoint.Ub;
+        sol_routes = checkpoint.Best_sol;
+        scenario_horizon = vehicles.back().Arrival_time + sol_sct;
+        sol_time = checkpoint.Elapsed;
+        iterations = checkpoint.Iterations;
+        publish_upper_bound(bounds, scenario, sol_sct, sol_routes, vehicles);
+        publish_lower_bound(bounds, scenario, sol_sct);
+        cout << "Scenario " << string_scenario << " solved before: " << sol_sct << endl;
+        cout << "-------------------------------------------------------------" << endl;
+        return;
+    }
+    cout << "Start solving " << string_scenario << " scenario" << endl;
+    if (COLUMN_CACHE) {
+        int cached_routes(read_column_cache(column_cache_file(key, string_scenario), key, models, vehicles, locations, transportation_times, blockings,
+                                            number_locations, number_tasks));
+        cout << "Routes from column cache: " << cached_routes << endl;
+    }
+    if (scenario == 0 && MIP_NF_SOLVE) {
+        bool warmstart(true);
+        bool nf(true);
+        solve_timecontinuous_mip_ub(sol_sct, sol_routes, models, vehicles, locations,
+                                    transportation_times, number_locations, sol_routes,
+                                    blockings, TIME_LIMIT, start_scenario, warmstart, nf);
+    }
+    else if (scenario == 1 && MIP_OF_SOLVE) {
+        // start from best known solution (of NF if already solved)
+        int lb(0);
+        fetch_scenario_bounds(bounds, scenario, sol_sct, sol_routes, scenario_horizon, lb, models, vehicles, blockings, number_locations);
+        bool warmstart(true);
+        solve_timecontinuous_mip_of(sol_sct, sol_routes, models, vehicles, locations,
+                                    transportation_times, number_locations, sol_routes,
+                                    blockings, TIME_LIMIT, start_scenario, warmstart);
+    }
+    else {
+        // with algorithmic framework: threshold search starting at root node lower bound
+        // without algorithmic framework: single branch-and-price run with best known solution as threshold
+        Search_settings settings(search_settings(checkpoint_file));
+        solve_threshold_search(models, vehicles, locations, number_locations, number_tasks, blockings, transportation_times,
+                               sol_routes, scenario_horizon, sol_sct, iterations, start_scenario, settings, bounds, scenario, key);
+    }
+    // the best solution is an upper bound even if the time limit is reached
+    publish_upper_bound(bounds, scenario, sol_sct, sol_routes, vehicles);
+    if (COLUMN_CACHE)
+        write_column_cache(column_cache_file(key, string_scenario), key, vehicles);
+    if (elapsed_seconds(start_scenario) < TIME_LIMIT) {
+        publish_lower_bound(bounds, scenario, sol_sct);
+        string name = instance + "_" + string_scenario;
+        write_schedule_to_csv(name, models, vehicles, transportation_times, sol_routes, sol_sct);
+        if (CHECKPOINT_INTERVAL > 0) {
+            checkpoint = Search_checkpoint();
+            checkpoint.Key = key;
+            checkpoint.Finished = true;
+            checkpoint.Ub = sol_sct;
+            checkpoint.Best_sol = sol_routes;
+            checkpoint.Elapsed = elapsed_seconds(start_scenario);
+            checkpoint.Iterations = iterations;
+            write_checkpoint(checkpoint_file, checkpoint, vehicles);
+        }
+    }
+    else {
+        sol_sct = -1;
+    }
+    cout << "Scenario " << string_scenario << " solved: " << sol_sct << endl;
+    cout << "-------------------------------------------------------------" << endl;
+    sol_time = elapsed_seconds(start_scenario);
+}
+//-----------------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+    Batch_options options = {INSTANCE_LIST, NUMBER_VEHICLES, BATCH_WORKERS, THREADS, BATCH_CORES, -1, MEMORY_LIMIT};
+    if (!parse_arguments(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (options.Workers > 0) {
+        // batch: spread instances over worker processes and merge their results
+        VecI statuses(run_batch(argv[0], options));
+        write_summary_to_csv(options.Instances, statuses, "Results/Solutions/summary.csv");
+        return 0;
+    }
+    THREADS = options.Threads;
+    NUMBER_VEHICLES = options.Vehicles;
+    limit_memory(options.Memory_limit);
+    bind_to_cores(options.First_core, options.Cores);
+    for (auto instance_it = options.Instances.begin(); instance_it != options.Instances.end(); ++instance_it) {
         cout << "--------------------------- Start ---------------------------" << endl;
         cout << "Start solving instance " << *instance_it << " with " << NUMBER_VEHICLES << " vehicles" << endl;
-        clock_t start_instance = clock();
+        Time_point start_instance = wall_clock();
+        reset_memory_accounting();
+        if (TELEMETRY)
+            open_telemetry("Results/Telemetry/" + (*instance_it) + ".jsonl");
         //---------------------------------------------------------------------------------------------------//
         // define and read instance data from csv file
-        clock_t start_read_data = clock();
+        Time_point start_read_data = wall_clock();
         int number_vehicles(NUMBER_VEHICLES);
         int number_locations, number_tasks, number_models, cycle_time, total_workload;
         Location start_loc, end_loc;
@@ -53,14 +260,18 @@ int main() {
         vector<Location> locations;
         vector<VecI> transportation_times;
         string filename(*instance_it + ".csv");
-        read_instance(filename, number_models, number_vehicles, number_locations, number_tasks,
-                      models, vehicles, locations, cycle_time, start_loc, end_loc, transportation_times, total_workload);
-        double time_read_data = double(clock() - start_read_data) / CLOCKS_PER_SEC;
+        uint64_t key(instance_key(filename, number_vehicles));
+        if (!read_instance(filename, number_models, number_vehicles, number_locations, number_tasks,
+                           models, vehicles, locations, cycle_time, start_loc, end_loc, transportation_times, total_workload)) {
+            close_telemetry();
+            continue;
+        }
+        double time_read_data = elapsed_seconds(start_read_data);
         //---------------------------------------------------------------------------------------------------//
         // preprocessing: generate possible model-task-location combinations and preselect routes (without timings)
-        clock_t start_preprocessing = clock();
+        Time_point start_preprocessing = wall_clock();
         preprocess(models, locations, number_locations, number_tasks, start_loc, end_loc);
-        double time_preprocessing = double(clock() - start_preprocessing) / CLOCKS_PER_SEC;
+        double time_preprocessing = elapsed_seconds(start_preprocessing);
         //---------------------------------------------------------------------------------------------------//
         // create upper bound by sequentially schedule all vehicles using NF routes
         int ub(-1);
@@ -76,115 +287,55 @@ int main() {
         vector<vector<vector<VecI>>> blockings;
         initialize_blockings(blockings, locations, vehicles, horizon);
         //---------------------------------------------------------------------------------------------------//
-        // initialize solution vectors: they show all optimal solutions for all scenarios and numbers of vehicles (we can use them as upper bounds for more flexible scenarios)
+        // initialize solution vectors: they show all optimal solutions for all scenarios and numbers of vehicles (shared bounds: see Scenario_bounds)
         VecI scenario_horizon(4, horizon);
         VecI sol_sct(4, ub);
         VecD sol_times(4, 0.0);
         VecI iterations(4, 0);
         vector<VecI> sol_routes(4, sol);
-        // solve all scenarios
+        Scenario_bounds bounds;
+        initialize_scenario_bounds(bounds, ub, sol, vehicles);
+        // check if OF potential (without potential, OF is equal to NF)
+        vector<vector<Model>> scenario_models(4, models);
+        int of_scenario(1);
+        string string_of("ERROR");
+        initialize_models_for_scenario(scenario_models[of_scenario], locations, number_locations, of_scenario, string_of);
+        bool of_has_potential(false);
+        check_of_potential(of_has_potential, scenario_models[of_scenario], locations, number_locations, number_tasks);
+        // solve all scenarios: concurrently on private copies of the column pool or one after another on one column pool
+        int number_pools(CONCURRENT_SCENARIOS ? 4 : 1);
+        vector<vector<Vehicle>> scenario_vehicles(number_pools, vehicles);
+        vector<vector<vector<vector<VecI>>>> scenario_blockings(number_pools, blockings);
+        vector<thread> scenario_threads;
         for (int scenario = 0; scenario != 4; ++scenario) {
-            clock_t start_scenario = clock();
-            string string_scenario("ERROR");
-            initialize_models_for_scenario(models, locations, number_locations, scenario, string_scenario);
-            cout << "Start solving " << string_scenario << " scenario" << endl;
-            if (scenario == 0 && MIP_NF_SOLVE) {
-                bool warmstart(true);
-                bool nf(true);
-                solve_timecontinuous_mip_ub(sol_sct[scenario], sol_routes[scenario], models, vehicles, locations,
-                                            transportation_times, number_locations, sol_routes[scenario],
-                                            blockings, TIME_LIMIT, start_scenario, warmstart, nf);
+            if (scenario == 1 && !of_has_potential)
+                continue;
+            int pool(CONCURRENT_SCENARIOS ? scenario : 0);
+            if (CONCURRENT_SCENARIOS) {
+                scenario_threads.push_back(thread(solve_scenario, scenario, (*instance_it), ref(scenario_models[scenario]), ref(scenario_vehicles[pool]),
+                                                  ref(locations), ref(transportation_times), ref(scenario_blockings[pool]), ref(number_locations),
+                                                  ref(number_tasks), ref(key), ref(bounds), ref(sol_sct[scenario]), ref(sol_routes[scenario]),
+                                                  ref(scenario_horizon[scenario]), ref(sol_times[scenario]), ref(iterations[scenario])));
             }
             else {
-                // check if OF potential
-                if (scenario == 1) {
-                    bool of_has_potential(false);
-                    check_of_potential(of_has_potential, models, locations, number_locations, number_tasks);
-                    if (!of_has_potential) {
-                        string name = (*instance_it) + "_" + string_scenario;
-                        write_schedule_to_csv(name, models, vehicles, transportation_times, sol_routes[scenario], sol_sct[scenario]);
-                        cout << "OF has no potential!" << endl;
-                        cout << "-------------------------------------------------------------" << endl;
-                        continue;
-                    }
-                    if (MIP_OF_SOLVE) {
-                        bool warmstart(true);
-                        solve_timecontinuous_mip_of(sol_sct[scenario], sol_routes[scenario], models, vehicles, locations,
-                                                    transportation_times, number_locations, sol_routes[scenario],
-                                                    blockings, TIME_LIMIT, start_scenario, warmstart);
-                    }
-                }
-                if (scenario != 1 || !MIP_OF_SOLVE) {
-                    int iter(1);
-                    int threshold;
-                    if (USE_ALGORITHMIC_FRAMEWORK) {
-                        // with algorithmic framework
-                        double root_node_lb = solve_root_node(scenario, models, vehicles, locations, number_locations,
-                                                              number_tasks,
-                                                              blockings, transportation_times, sol_routes[scenario],
-                                                              scenario_horizon[scenario], sol_sct[scenario],
-                                                              start_scenario, TIME_LIMIT,
-                                                              MASTER_ACTIVITY_END, MAX_ROUTES_PER_VEHICLE);
-                        threshold = (int) ceil(root_node_lb) + 1;
-                    }
-                    else {
-                        // without algorithmic framework
-                        threshold = (int) sol_sct[scenario];
-                    }
-                    while (threshold <= sol_sct[scenario]) {
-                        cout << "Try threshold < " << threshold << endl;
-                        int current_threshold(threshold);
-                        int ub_escape(threshold - 1);
-                        VecI best_routes(sol_routes[scenario]);
-                        scenario_horizon[scenario] = vehicles.back().Arrival_time + current_threshold;
-                        solve_branch_and_price(scenario, models, vehicles, locations, number_locations, number_tasks,
-                                               blockings, transportation_times, best_routes, scenario_horizon[scenario], current_threshold, ub_escape,
-                                               start_scenario, TIME_LIMIT, MASTER_ACTIVITY_END, BRANCHING, MAX_ROUTES_PER_VEHICLE);
-                        if (current_threshold == threshold) {
-                            ++threshold;
-                            ++iter;
-                            if (double(clock() - start_scenario) / CLOCKS_PER_SEC >= TIME_LIMIT)
-                                break;
-                        }
-                        else {
-                            sol_sct[scenario] = current_threshold;
-                            sol_routes[scenario] = best_routes;
-                            break;
-                        }
-                    }
-                    iterations[scenario] = iter;
-                }
-            }
-            if (double(clock() - start_scenario) / CLOCKS_PER_SEC < TIME_LIMIT) {
-                string name = (*instance_it) + "_" + string_scenario;
-                write_schedule_to_csv(name, models, vehicles, transportation_times, sol_routes[scenario], sol_sct[scenario]);
-                if (scenario == 0) {
-                    sol_sct[1] = sol_sct[0];
-                    sol_routes[1] = sol_routes[0];
-                    scenario_horizon[1] = scenario_horizon[0];
-                    sol_sct[2] = sol_sct[0];
-                    sol_routes[2] = sol_routes[0];
-                    scenario_horizon[2] = scenario_horizon[0];
-                    sol_sct[3] = sol_sct[0];
-                    sol_routes[3] = sol_routes[0];
-                    scenario_horizon[3] = scenario_horizon[0];
-                }
-                else if (scenario == 2) {
-                    sol_sct[3] = sol_sct[2];
-                    sol_routes[3] = sol_routes[2];
-                    scenario_horizon[3] = scenario_horizon[2];
-                }
+                solve_scenario(scenario, (*instance_it), scenario_models[scenario], scenario_vehicles[pool], locations, transportation_times,
+                               scenario_blockings[pool], number_locations, number_tasks, key, bounds, sol_sct[scenario], sol_routes[scenario],
+                               scenario_horizon[scenario], sol_times[scenario], iterations[scenario]);
             }
-            else {
-                sol_sct[scenario] = -1;
-            }
-
-            cout << "Scenario " << string_scenario << " solved: " << sol_sct[scenario] << endl;
+        }
+        for (auto it = scenario_threads.begin(); it != scenario_threads.end(); ++it) {
+            (*it).join();
+        }
+        if (!of_has_potential) {
+            sol_sct[1] = sol_sct[0];
+            sol_routes[1] = sol_routes[0];
+            string name = (*instance_it) + "_" + string_of;
+            write_schedule_to_csv(name, scenario_models[1], scenario_vehicles[0], transportation_times, sol_routes[1], sol_sct[1]);
+            cout << "OF has no potential!" << endl;
             cout << "-------------------------------------------------------------" << endl;
-            sol_times[scenario] = double(clock() - start_scenario) / CLOCKS_PER_SEC;
         }
         //---------------------------------------------------------------------------------------------------//
-        double time_instance = double(clock() - start_instance) / CLOCKS_PER_SEC;
+        double time_instance = elapsed_seconds(start_instance);
         cout << "---------------------------- End ----------------------------" << endl;
         cout << "Time to solve instance: " << time_instance << " seconds" << endl;
         cout << "Time to read data: " << time_read_data << " seconds" << endl;
@@ -194,6 +345,8 @@ int main() {
         cout << "Time RF scenario: " << sol_times[2] << " seconds" << endl;
         cout << "Time FF scenario: " << sol_times[3] << " seconds" << endl;
         cout << "-------------------------------------------------------------" << endl;
+        print_memory_accounting();
+        cout << "-------------------------------------------------------------" << endl;
         cout << "Optimal SCT NF scenario: " << sol_sct[0] << "\t" << round((sol_sct[0] - sol_sct[0]) * 1.0 / sol_sct[0] * 1000) / 10.0 << "%" << endl;
         cout << "Optimal SCT OF scenario: " << sol_sct[1] << "\t" << round((sol_sct[0] - sol_sct[1]) * 1.0 / sol_sct[0] * 1000) / 10.0 << "%" << endl;
         cout << "Optimal SCT RF scenario: " << sol_sct[2] << "\t" << round((sol_sct[0] - sol_sct[2]) * 1.0 / sol_sct[0] * 1000) / 10.0 << "%" << endl;
@@ -201,6 +354,7 @@ int main() {
         cout << "-------------------------------------------------------------" << endl;
         // derive worker utilization
         write_solutions_to_csv(*instance_it, sol_sct, sol_times, iterations);
+        close_telemetry();
     }
     return 0;
 }
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Memory accounting of the major data structures. Sizes are estimated from the data structures (vector capacities,
+ * map nodes) and sampled per subsystem: the node data after each node, the shared column pool and tree at most every
+ * MEMORY_SAMPLE_INTERVAL seconds (a sample walks all routes and leaves, so peaks in between are not seen):
+ * Blockings (location-time blockings of the column pool), Route_pool (routes of the vehicles), Open_nodes (open and
+ * retired leaves of the B&B tree with their ancestors), Node (materialized nodes of the workers), Labels (peak of route
+ * fragments of the pricing algorithms per node), and Master (Gurobi master problem, estimated from its size).
+ * Samples are kept per source (a run, or a worker thread of a run); the current size of a subsystem is the sum over all
+ * sources, and its peak is the maximum of the current sizes. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+const double MEMORY_SAMPLE_INTERVAL(5.0); // seconds between samples of the column pool and the tree
+const size_t MAP_NODE_OVERHEAD(32); // bytes of a red-black tree node in addition to its value
+const size_t GUROBI_BYTES_PER_NONZERO(24); // estimated bytes of Gurobi per constraint matrix nonzero (row and column copy)
+const size_t GUROBI_BYTES_PER_ROW_COLUMN(96); // estimated bytes of Gurobi per variable and constraint (bounds, names, basis)
+//------------------------------------------------------------------------------------------------------------//
+struct Memory_accounting {
+    mutex Mutex; // protects all members
+    map<string, map<string, size_t>> Current; // sampled bytes per source and subsystem
+    map<string, size_t> Peak; // peak bytes per subsystem
+};
+//------------------------------------------------------------------------------------------------------------//
+Memory_accounting &memory_accounting() {
+    static Memory_accounting accounting;
+    return accounting;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Heap bytes owned by a value (without the value itself). */
+template <typename T>
+typename enable_if<is_arithmetic<T>::value, size_t>::type heap_bytes(const T &) {
+    return 0;
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t heap_bytes(const VecB &values) {
+    return values.capacity() / 8;
+}
+//------------------------------------------------------------------------------------------------------------//
+template <typename T>
+size_t heap_bytes(const vector<T> &values) {
+    size_t bytes(values.capacity() * sizeof(T));
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        bytes += heap_bytes(*it);
+    }
+    return bytes;
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t heap_bytes(const Vehicle &vehicle) {
+    return heap_bytes(vehicle.All_routes) + heap_bytes(vehicle.Available_routes) + heap_bytes(vehicle.Route_details)
+           + heap_bytes(vehicle.Route_scts) + heap_bytes(vehicle.Route_start_times) + heap_bytes(vehicle.Route_end_times)
+           + heap_bytes(vehicle.Available_task_location_combinations);
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t heap_bytes(const Node &node) {
+    return heap_bytes(node.Fixed_vehicle_location_tasks) + heap_bytes(node.Task_start_times_lower_bounds)
+           + heap_bytes(node.Task_start_times_upper_bounds) + heap_bytes(node.Enforced_vehicle_location_times)
+           + heap_bytes(node.Forbidden_vehicle_location_times) + heap_bytes(node.Forbidden_vehicle_routes)
+           + heap_bytes(node.Forbidden_vehicle_location_combinations);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Bytes of an open node and its ancestors that are not counted yet (ancestors are shared by their subtrees). */
+size_t open_node_bytes(const Open_node &node, set<const Open_node *> &counted) {
+    size_t bytes(heap_bytes(node.Fixings));
+    for (const Open_node *ancestor = node.Parent.get(); ancestor != nullptr; ancestor = (*ancestor).Parent.get()) {
+        if (!counted.insert(ancestor).second)
+            break;
+        bytes += sizeof(Open_node) + heap_bytes((*ancestor).Fixings);
+    }
+    return bytes;
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t route_pool_bytes(vector<Vehicle> &vehicles) {
+    return heap_bytes(vehicles);
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t node_bytes(Node &node) {
+    return sizeof(Node) + heap_bytes(node);
+}
+//------------------------------------------------------------------------------------------------------------//
+size_t master_bytes(GRBModel &master_problem) {
+    return GUROBI_BYTES_PER_NONZERO * (size_t) master_problem.get(GRB_IntAttr_NumNZs)
+           + GUROBI_BYTES_PER_ROW_COLUMN * (size_t) (master_problem.get(GRB_IntAttr_NumVars) + master_problem.get(GRB_IntAttr_NumConstrs));
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Source of the samples of the calling thread within its run. */
+string thread_memory_source() {
+    stringstream source;
+    source << telemetry_run() << "/" << this_thread::get_id();
+    return source.str();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Record the current bytes of a subsystem for source. */
+void sample_memory(string source, string subsystem, size_t bytes) {
+    Memory_accounting &accounting(memory_accounting());
+    lock_guard<mutex> lock(accounting.Mutex);
+    accounting.Current[source][subsystem] = bytes;
+    size_t total(0);
+    for (auto it = accounting.Current.begin(); it != accounting.Current.end(); ++it) {
+        auto s_it((*it).second.find(subsystem));
+        if (s_it != (*it).second.end())
+            total += (*s_it).second;
+    }
+    accounting.Peak[subsystem] = max(accounting.Peak[subsystem], total);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Remove the samples of a source that ended (peaks are kept). */
+void release_memory_samples(string source) {
+    Memory_accounting &accounting(memory_accounting());
+    lock_guard<mutex> lock(accounting.Mutex);
+    accounting.Current.erase(source);
+}
+//------------------------------------------------------------------------------------------------------------//
+void reset_memory_accounting() {
+    Memory_accounting &accounting(memory_accounting());
+    lock_guard<mutex> lock(accounting.Mutex);
+    accounting.Current.clear();
+    accounting.Peak.clear();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Peak resident memory of the process in bytes (only on Linux, 0 otherwise). */
+size_t process_peak_bytes() {
+#ifdef __linux__
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return (size_t) stoull(line.substr(6)) * 1024;
+    }
+#endif
+    return 0;
+}
+//------------------------------------------------------------------------------------------------------------//
+void print_memory_accounting() {
+    Memory_accounting &accounting(memory_accounting());
+    lock_guard<mutex> lock(accounting.Mutex);
+    size_t total(0);
+    for (auto it = accounting.Peak.begin(); it != accounting.Peak.end(); ++it) {
+        cout << "Peak memory " << (*it).first << ": " << round((*it).second / 1048576.0 * 10) / 10.0 << " MB" << endl;
+        total += (*it).second;
+    }
+    cout << "Peak memory sum of subsystems: " << round(total / 1048576.0 * 10) / 10.0 << " MB" << endl;
+    size_t process(process_peak_bytes());
+    if (process > 0)
+        cout << "Peak memory of process: " << round(process / 1048576.0 * 10) / 10.0 << " MB" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -13,7 +13,7 @@ typedef vector<string> VecS;
 /* Solve timecontinuous MIP UB search using GUROBI. */
 void solve_timecontinuous_mip_ub(int &ub, VecI &best_sol, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
                   vector<VecI> &transportation_times, int &number_locations, VecI &used_routes_without_timings,
-                  vector<vector<vector<VecI>>> &blockings, double &time_limit, clock_t &start_scenario, bool &warmstart, bool &nf) {
+                  vector<vector<vector<VecI>>> &blockings, double &time_limit, Time_point &start_scenario, bool &warmstart, bool &nf) {
     int horizon(vehicles.back().Arrival_time + ub);
     //initialize Gurobi problem
     // create Gurobi environment
@@ -22,7 +22,7 @@ void solve_timecontinuous_mip_ub(int &ub, VecI &best_sol, vector<Model> &models,
     // create empty model
     GRBModel problem = GRBModel(env);
     problem.set(GRB_IntParam_OutputFlag, 0);
-    problem.set(GRB_DoubleParam_TimeLimit, max(0.0, double(time_limit - double(double(clock() - start_scenario) / CLOCKS_PER_SEC))));
+    problem.set(GRB_DoubleParam_TimeLimit, max(0.0, time_limit - elapsed_seconds(start_scenario)));
     // define decisions
     vector<vector<GRBVar>> var_start_times;
     for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
@@ -179,7 +179,7 @@ void solve_timecontinuous_mip_ub(int &ub, VecI &best_sol, vector<Model> &models,
 /* Solve timecontinuous MIP OF search using GUROBI. */
 void solve_timecontinuous_mip_of(int &ub, VecI &best_sol, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
                                  vector<VecI> &transportation_times, int &number_locations, VecI &used_routes_without_timings,
-                                 vector<vector<vector<VecI>>> &blockings, double &time_limit, clock_t &start_scenario, bool &warmstart) {
+                                 vector<vector<vector<VecI>>> &blockings, double &time_limit, Time_point &start_scenario, bool &warmstart) {
     vector<vector<VecI>> arcs;
     vector<VecI> used_locations;
     vector<VecI> workloads;
@@ -253,7 +253,7 @@ void solve_timecontinuous_mip_of(int &ub, VecI &best_sol, vector<Model> &models,
     // create empty model
     GRBModel problem = GRBModel(env);
     problem.set(GRB_IntParam_OutputFlag, 0);
-    problem.set(GRB_DoubleParam_TimeLimit, max(0.0, double(time_limit - double(double(clock() - start_scenario) / CLOCKS_PER_SEC))));
+    problem.set(GRB_DoubleParam_TimeLimit, max(0.0, time_limit - elapsed_seconds(start_scenario)));
     // define decisions
     vector<vector<GRBVar>> var_use_arc;
     for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Open nodes of the B&B tree.
+ * Nodes are selected from a heap ordered by the node selection rule; the global lower bound is tracked in a
+ * separate min-heap. Both heaps are cleaned lazily, i.e., entries of already selected or pruned nodes are
+ * skipped when they reach the top.*/
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* Sorting key of an open node. */
+struct Node_key {
+    int Id; // node identifier
+    double Lb; // lower bound
+    int Depth; // depth of node in tree
+    int Preference; // cumulative branching preference
+};
+//------------------------------------------------------------------------------------------------------------//
+struct Open_nodes {
+    string Selection; // node selection rule: DEPTH, BEST_BOUND, or HYBRID
+    int Best_bound_frequency; // HYBRID: every n-th selected node is the node with the lowest lower bound
+    int Selection_count; // number of nodes selected so far
+    map<int, Open_node> Nodes; // open nodes by node identifier
+    vector<Node_key> Selection_heap; // heap of node keys ordered by node selection rule
+    vector<pair<double, int>> Lb_heap; // min-heap of (lower bound, node identifier)
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Check whether node n1 is selected before node n2.
+ * DEPTH: deepest node first, ties broken by preference, lower bound, and identifier.
+ * BEST_BOUND: lowest lower bound first, ties broken by depth, preference, and identifier. */
+bool select_before(const Node_key &n1, const Node_key &n2, const string &selection) {
+    if (selection == "BEST_BOUND") {
+        if (n1.Lb != n2.Lb)
+            return n1.Lb < n2.Lb;
+        if (n1.Depth != n2.Depth)
+            return n1.Depth > n2.Depth;
+    }
+    else {
+        if (n1.Depth != n2.Depth)
+            return n1.Depth > n2.Depth;
+        if (n1.Preference != n2.Preference)
+            return n1.Preference > n2.Preference;
+        if (n1.Lb != n2.Lb)
+            return n1.Lb < n2.Lb;
+    }
+    if (n1.Preference != n2.Preference)
+        return n1.Preference > n2.Preference;
+    return n1.Id < n2.Id;
+}
+//------------------------------------------------------------------------------------------------------------//
+void initialize_open_nodes(Open_nodes &open_nodes, string &selection, int &best_bound_frequency) {
+    open_nodes.Selection = selection;
+    open_nodes.Best_bound_frequency = max(1, best_bound_frequency);
+    open_nodes.Selection_count = 0;
+    open_nodes.Nodes.clear();
+    open_nodes.Selection_heap.clear();
+    open_nodes.Lb_heap.clear();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Rebuild both heaps from the open nodes, dropping entries of nodes that are no longer open. */
+void rebuild_open_node_heaps(Open_nodes &open_nodes) {
+    string selection(open_nodes.Selection);
+    open_nodes.Selection_heap.clear();
+    open_nodes.Lb_heap.clear();
+    for (auto it = open_nodes.Nodes.begin(); it != open_nodes.Nodes.end(); ++it) {
+        open_nodes.Selection_heap.push_back({(*it).second.Id, (*it).second.Lb, (*it).second.Depth, (*it).second.Preference});
+        open_nodes.Lb_heap.push_back({(*it).second.Lb, (*it).second.Id});
+    }
+    make_heap(open_nodes.Selection_heap.begin(), open_nodes.Selection_heap.end(), [&selection](const auto &n1, const auto &n2) {return select_before(n2, n1, selection);});
+    make_heap(open_nodes.Lb_heap.begin(), open_nodes.Lb_heap.end(), greater<pair<double, int>>());
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Add node to open nodes. The node is moved into the container. */
+void push_open_node(Open_nodes &open_nodes, Open_node &node) {
+    string selection(open_nodes.Selection);
+    open_nodes.Selection_heap.push_back({node.Id, node.Lb, node.Depth, node.Preference});
+    push_heap(open_nodes.Selection_heap.begin(), open_nodes.Selection_heap.end(), [&selection](const auto &n1, const auto &n2) {return select_before(n2, n1, selection);});
+    open_nodes.Lb_heap.push_back({node.Lb, node.Id});
+    push_heap(open_nodes.Lb_heap.begin(), open_nodes.Lb_heap.end(), greater<pair<double, int>>());
+    int id(node.Id);
+    open_nodes.Nodes.emplace(id, move(node));
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Remove entries of closed nodes from the top of the lower bound heap. */
+void clean_lb_heap(Open_nodes &open_nodes) {
+    while (!open_nodes.Lb_heap.empty() && open_nodes.Nodes.find(open_nodes.Lb_heap.front().second) == open_nodes.Nodes.end()) {
+        pop_heap(open_nodes.Lb_heap.begin(), open_nodes.Lb_heap.end(), greater<pair<double, int>>());
+        open_nodes.Lb_heap.pop_back();
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Select next node according to node selection rule and remove it from open nodes. Open nodes must not be empty. */
+void pop_open_node(Open_nodes &open_nodes, Open_node &node) {
+    string selection(open_nodes.Selection);
+    ++open_nodes.Selection_count;
+    int id(-1);
+    if (selection == "HYBRID" && open_nodes.Selection_count % open_nodes.Best_bound_frequency == 0) {
+        clean_lb_heap(open_nodes);
+        id = open_nodes.Lb_heap.front().second;
+    }
+    else {
+        while (1) {
+            pop_heap(open_nodes.Selection_heap.begin(), open_nodes.Selection_heap.end(), [&selection](const auto &n1, const auto &n2) {return select_before(n2, n1, selection);});
+            int top_id(open_nodes.Selection_heap.back().Id);
+            open_nodes.Selection_heap.pop_back();
+            if (open_nodes.Nodes.find(top_id) != open_nodes.Nodes.end()) {
+                id = top_id;
+                break;
+            }
+        }
+    }
+    auto it = open_nodes.Nodes.find(id);
+    node = move((*it).second);
+    open_nodes.Nodes.erase(it);
+    // keep lazily deleted heap entries bounded by the number of open nodes
+    if (open_nodes.Selection_heap.size() > 2 * open_nodes.Nodes.size() + 16 || open_nodes.Lb_heap.size() > 2 * open_nodes.Nodes.size() + 16)
+        rebuild_open_node_heaps(open_nodes);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Cut off open nodes that cannot contain a solution better than ub. Cut off nodes are moved to retired. */
+void prune_open_nodes(Open_nodes &open_nodes, int &ub, vector<Open_node> &retired) {
+    bool pruned(false);
+    auto it = open_nodes.Nodes.begin();
+    while (it != open_nodes.Nodes.end()) {
+        if (ub - (*it).second.Lb < 1 - PRECISION) {
+            retired.push_back(move((*it).second));
+            it = open_nodes.Nodes.erase(it);
+            pruned = true;
+        }
+        else {
+            ++it;
+        }
+    }
+    if (pruned)
+        rebuild_open_node_heaps(open_nodes);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Lowest lower bound of all open nodes. Open nodes must not be empty. */
+double open_nodes_lower_bound(Open_nodes &open_nodes) {
+    clean_lb_heap(open_nodes);
+    return open_nodes.Lb_heap.front().first;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Bytes of open and retired leaves with their ancestors and of the heaps. */
+size_t open_nodes_bytes(Open_nodes &open_nodes, vector<Open_node> &retired) {
+    set<const Open_node *> counted;
+    size_t bytes((sizeof(pair<const int, Open_node>) + MAP_NODE_OVERHEAD) * open_nodes.Nodes.size());
+    for (auto it = open_nodes.Nodes.begin(); it != open_nodes.Nodes.end(); ++it) {
+        bytes += open_node_bytes((*it).second, counted);
+    }
+    bytes += retired.capacity() * sizeof(Open_node);
+    for (auto it = retired.begin(); it != retired.end(); ++it) {
+        bytes += open_node_bytes((*it), counted);
+    }
+    bytes += open_nodes.Selection_heap.capacity() * sizeof(Node_key) + open_nodes.Lb_heap.capacity() * sizeof(pair<double, int>);
+    return bytes;
+}
+//------------------------------------------------------------------------------------------------------------//
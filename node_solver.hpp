@@ -10,22 +10,329 @@ typedef vector<double> VecD;
 typedef vector<string> VecS;
 typedef vector<size_t> VecT;
 //------------------------------------------------------------------------------------------------------------//
-/* Solve node.*/
-void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &node_lb, bool &node_is_integral, bool &node_is_feasible, vector<VecD> &node_split_routes,
+/* Keep the max_routes_per_vehicle routes of a vehicle with the most negative reduced cost. */
+void keep_most_negative_routes(vector<vector<VecI>> &new_routes_v, VecD &new_routes_cost_v, int &max_routes_per_vehicle) {
+    if ((int) new_routes_v.size() <= max_routes_per_vehicle)
+        return;
+    struct route {
+        int Id;
+        vector<VecI> Route;
+        double Cost;
+    };
+    vector<route> route_list_v;
+    for (int x = 0; x != new_routes_v.size(); ++x) {
+        route new_route;
+        new_route.Id = x;
+        new_route.Route = new_routes_v[x];
+        new_route.Cost = new_routes_cost_v[x];
+        route_list_v.push_back(new_route);
+    }
+    sort(route_list_v.begin(), route_list_v.end(), [](const auto &r1, const auto &r2) {return r1.Id < r2.Id;});
+    sort(route_list_v.begin(), route_list_v.end(), [](const auto &r1, const auto &r2) {return r1.Cost < r2.Cost;});
+    vector<vector<VecI>> new_new_routes_v;
+    VecD new_new_routes_cost_v;
+    int count = 0;
+    for (auto it = route_list_v.begin(); it != route_list_v.end(); ++it, ++count) {
+        if (count == max_routes_per_vehicle) {
+            break;
+        }
+        new_new_routes_v.push_back((*it).Route);
+        new_new_routes_cost_v.push_back((*it).Cost);
+    }
+    new_routes_v = new_new_routes_v;
+    new_routes_cost_v = new_new_routes_cost_v;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Select at most max_routes_per_vehicle new routes of a vehicle by column selection policy.
+ * MOST_NEGATIVE: routes with the most negative reduced cost.
+ * DIVERSE: starting with the most negative route, greedily add the route that covers the most location-time cells
+ * (rows of blocking constraints) not covered by the routes selected so far. A cell is weighted by the inverse of one
+ * plus the number of the node's routes that already block it. Ties are broken by reduced cost.
+ * MIXED: half of the routes by MOST_NEGATIVE, the others by DIVERSE. */
+void select_routes(vector<vector<VecI>> &new_routes_v, VecD &new_routes_cost_v, int &max_routes_per_vehicle, string &column_selection,
+        Model &model, vector<vector<vector<VecI>>> &available_blockings, int &number_locations) {
+    if ((int) new_routes_v.size() <= max_routes_per_vehicle)
+        return;
+    if (column_selection == "MOST_NEGATIVE") {
+        keep_most_negative_routes(new_routes_v, new_routes_cost_v, max_routes_per_vehicle);
+        return;
+    }
+    VecI order;
+    for (int x = 0; x != (int) new_routes_v.size(); ++x) {
+        order.push_back(x);
+    }
+    stable_sort(order.begin(), order.end(), [&new_routes_cost_v](const int &x1, const int &x2) {return new_routes_cost_v[x1] < new_routes_cost_v[x2];});
+    int most_negative(column_selection == "MIXED" ? (max_routes_per_vehicle + 1) / 2 : 1);
+    VecI selected(order.begin(), order.begin() + min(most_negative, max_routes_per_vehicle));
+    VecB is_selected(new_routes_v.size(), false);
+    vector<VecB> covered;
+    for (auto l_it = available_blockings.begin(); l_it != available_blockings.end(); ++l_it) {
+        covered.push_back(VecB((*l_it).size(), false));
+    }
+    auto cover = [&](int x) {
+        is_selected[x] = true;
+        for (auto it = new_routes_v[x].begin(); it != new_routes_v[x].end(); ++it) {
+            if ((*it)[0] != 0 && (*it)[0] != number_locations - 1) {
+                for (int z = (*it)[2]; z != (*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]]; ++z) {
+                    covered[(*it)[0]][z] = true;
+                }
+            }
+        }
+    };
+    for (auto it = selected.begin(); it != selected.end(); ++it) {
+        cover(*it);
+    }
+    while ((int) selected.size() < max_routes_per_vehicle) {
+        int best(-1);
+        double best_coverage(-1.0);
+        for (auto o_it = order.begin(); o_it != order.end(); ++o_it) {
+            if (is_selected[*o_it])
+                continue;
+            double coverage(0.0);
+            for (auto it = new_routes_v[*o_it].begin(); it != new_routes_v[*o_it].end(); ++it) {
+                if ((*it)[0] != 0 && (*it)[0] != number_locations - 1) {
+                    for (int z = (*it)[2]; z != (*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]]; ++z) {
+                        if (!covered[(*it)[0]][z])
+                            coverage += 1.0 / (1 + available_blockings[(*it)[0]][z].size());
+                    }
+                }
+            }
+            if (coverage > best_coverage + PRECISION) {
+                best = *o_it;
+                best_coverage = coverage;
+            }
+        }
+        selected.push_back(best);
+        cover(best);
+    }
+    vector<vector<VecI>> selected_routes_v;
+    VecD selected_routes_cost_v;
+    for (auto it = selected.begin(); it != selected.end(); ++it) {
+        selected_routes_v.push_back(new_routes_v[*it]);
+        selected_routes_cost_v.push_back(new_routes_cost_v[*it]);
+    }
+    new_routes_v = selected_routes_v;
+    new_routes_cost_v = selected_routes_cost_v;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Routes found by asynchronous pricing on the duals of a previous column generation iteration. */
+struct Speculative_routes {
+    VecI Vehicles; // priced vehicles
+    vector<vector<vector<VecI>>> New_routes; // new routes of priced vehicles
+    Pricing_statistics Statistics; // work of the pricing algorithms
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Copy of the data of a vehicle read by pricing, i.e., without its routes. */
+Vehicle pricing_snapshot(Vehicle &vehicle) {
+    Vehicle snapshot;
+    snapshot.Id = vehicle.Id;
+    snapshot.Arrival_time = vehicle.Arrival_time;
+    snapshot.Type = vehicle.Type;
+    snapshot.Available_task_location_combinations = vehicle.Available_task_location_combinations;
+    snapshot.Max_cost = vehicle.Max_cost;
+    snapshot.Sct_cost = vehicle.Sct_cost;
+    snapshot.Current_sct = vehicle.Current_sct;
+    return snapshot;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Price vehicle snapshots on a copy of the duals. Runs concurrently to the master solve: duals, ub, and horizon are
+ * copies; models, locations, transportation times, and node are only read during column generation. The blockings
+ * change while columns are added, so the routes with the most negative reduced cost are kept. */
+Speculative_routes price_speculatively(vector<Vehicle> snapshots, vector<VecD> block_cost, VecD cut_cost, vector<vector<VecI>> zero_half_cuts,
+        vector<Model> &models, vector<Location> &locations, vector<VecI> &transportation_times, int number_locations, int number_tasks,
+        Node &parent_node, int ub, int horizon, int max_routes_per_vehicle, string engine, int pulse_labels) {
+    Speculative_routes speculative;
+    speculative.Statistics = {};
+    for (auto v_it = snapshots.begin(); v_it != snapshots.end(); ++v_it) {
+        vector<vector<VecI>> new_routes_v;
+        VecD new_routes_cost_v;
+        price_vehicle(engine, pulse_labels, new_routes_v, new_routes_cost_v, (*v_it).Id, (*v_it), models[(*v_it).Type], locations, block_cost, cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, parent_node, ub, horizon,
+                      speculative.Statistics);
+        keep_most_negative_routes(new_routes_v, new_routes_cost_v, max_routes_per_vehicle);
+        speculative.Vehicles.push_back((*v_it).Id);
+        speculative.New_routes.push_back(new_routes_v);
+    }
+    return speculative;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Column transfer: vehicles of the same model differ only in their arrival times. Every new route of a vehicle is
+ * shifted by the difference of arrival times and offered to the other vehicles of the model if the shifted route is
+ * feasible in the node, not in the vehicle's pool, and has negative reduced cost for the vehicle's duals. */
+void transfer_routes(vector<vector<vector<VecI>>> &new_routes, vector<VecD> &new_routes_cost, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, Node &parent_node, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts,
+        int &number_tasks, int &number_locations, int &ub, int &max_routes_per_vehicle) {
+    vector<vector<vector<VecI>>> priced_routes(new_routes);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        for (auto r_it = priced_routes[(*v_it).Id].begin(); r_it != priced_routes[(*v_it).Id].end(); ++r_it) {
+            for (auto w_it = vehicles.begin(); w_it != vehicles.end(); ++w_it) {
+                if ((*w_it).Id == (*v_it).Id || (*w_it).Type != (*v_it).Type || (int) new_routes[(*w_it).Id].size() >= max_routes_per_vehicle)
+                    continue;
+                vector<VecI> shifted_route(*r_it);
+                for (auto it = shifted_route.begin(); it != shifted_route.end(); ++it) {
+                    (*it)[2] += (*w_it).Arrival_time - (*v_it).Arrival_time;
+                }
+                if (shifted_route.back()[2] - (*w_it).Arrival_time >= ub)
+                    continue;
+                if (find(new_routes[(*w_it).Id].begin(), new_routes[(*w_it).Id].end(), shifted_route) != new_routes[(*w_it).Id].end())
+                    continue;
+                if (find((*w_it).Route_details.begin(), (*w_it).Route_details.end(), shifted_route) != (*w_it).Route_details.end())
+                    continue;
+                Model &model(models[(*w_it).Type]);
+                VecI start_times, end_times;
+                route_location_times(start_times, end_times, shifted_route, model, number_locations);
+                if (!route_is_feasible_in_node(shifted_route, start_times, end_times, (*w_it), model, locations, parent_node, number_tasks))
+                    continue;
+                double reduced_cost(route_reduced_cost(shifted_route, (*w_it), model, block_cost, cut_cost, zero_half_cuts, number_locations));
+                if (reduced_cost > -PRECISION)
+                    continue;
+                new_routes[(*w_it).Id].push_back(shifted_route);
+                new_routes_cost[(*w_it).Id].push_back(reduced_cost + (*w_it).Max_cost);
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Restricted master MIP: solve the master problem over the current column pool with binary route variables.
+ * Only routes that are available in node and shorter than ub are considered. Returns true if the MIP is solved to
+ * optimality, i.e., the pool contains no other solution with sct < ub. */
+bool solve_restricted_master_mip(int &ub, VecI &best_sol, Node &node, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations,
+        vector<vector<vector<VecI>>> &blockings, int &number_tasks, int &number_locations, bool &master_activity_end, double &mip_time_limit,
+        double &time_limit, Time_point &start_scenario) {
+    int horizon(vehicles.back().Arrival_time + ub);
+    vector<vector<vector<VecI>>> available_blockings;
+    preprocess_node(models, vehicles, locations, blockings, available_blockings, node, number_tasks, number_locations, ub, horizon);
+    // create Gurobi environment
+    GRBEnv env = new GRBEnv();
+    env.start();
+    // create master problem with binary route variables
+    GRBModel master_problem = GRBModel(env);
+    GRBVar segment_cycle_time;
+    vector<vector<GRBVar>> use_route;
+    vector<GRBVar> dummy;
+    vector<VecI> active_ends;
+    create_master(master_activity_end, master_problem, segment_cycle_time, use_route, dummy, active_ends, vehicles, locations, number_locations, available_blockings, horizon);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        dummy[(*v_it).Id].set(GRB_DoubleAttr_UB, 0.0);
+        for (auto it = use_route[(*v_it).Id].begin(); it != use_route[(*v_it).Id].end(); ++it) {
+            (*it).set(GRB_CharAttr_VType, GRB_BINARY);
+        }
+    }
+    master_problem.set(GRB_DoubleParam_TimeLimit, max(0.0, min(mip_time_limit, time_limit - elapsed_seconds(start_scenario))));
+    master_problem.set(GRB_DoubleParam_Cutoff, ub - 0.5);
+    master_problem.update();
+    master_problem.optimize();
+    if (master_problem.get(GRB_IntAttr_SolCount) > 0) {
+        double sol(master_problem.get(GRB_DoubleAttr_ObjVal));
+        if ((int) round(sol) < ub) {
+            cout << "MIP-RM: ";
+            update_best(ub, sol, segment_cycle_time, best_sol, vehicles, use_route);
+        }
+    }
+    int status(master_problem.get(GRB_IntAttr_Status));
+    return status == 2 || status == 3 || status == 6; // optimal, infeasible, or no solution below cutoff
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Route enumeration for nodes with small gap: for the optimal duals of the node's LP, every solution with sct < ub only
+ * uses routes with reduced cost <= ub - 1 - node_lb. All such routes are enumerated by the labeling algorithm with the
+ * gap as pruning bound and without dominance, added to the column pool, and the node is solved as MIP over them.
+ * Returns true if the node is solved exactly, i.e., no vehicle exceeds route_limit routes and the MIP is optimal. */
+bool solve_node_by_enumeration(int &ub, VecI &best_sol, double &node_lb, Node &parent_node, vector<Model> &models, vector<Vehicle> &vehicles,
+        vector<Location> &locations, vector<vector<vector<VecI>>> &blockings, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts,
+        vector<VecI> &transportation_times, int &number_tasks, int &number_locations, int &horizon, bool &master_activity_end, int &route_limit,
+        double &mip_time_limit, double &time_limit, Time_point &start_scenario) {
+    double rc_limit(ub - 1 - node_lb + 2 * PRECISION);
+    bool enumerate(true);
+    atomic<bool> stop(false);
+    Pricing_statistics statistics = {};
+    Node enumeration_node(parent_node);
+    int number_routes(0);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        Model &model(models[(*v_it).Type]);
+        VecB enumerated((*v_it).All_routes.size(), false);
+        if ((*v_it).Max_cost + rc_limit > model.Min_sct * (*v_it).Sct_cost) {
+            vector<vector<VecI>> routes;
+            VecD routes_cost;
+            find_new_routes(routes, routes_cost, (*v_it).Id, (*v_it), model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                            number_locations, number_tasks, parent_node, ub, horizon, rc_limit, enumerate, route_limit, stop, statistics);
+            if ((int) routes.size() > route_limit) {
+                cout << "Enumeration: more than " << route_limit << " routes for V" << (*v_it).Id << endl;
+                return false;
+            }
+            for (auto r_it = routes.begin(); r_it != routes.end(); ++r_it) {
+                auto it(find((*v_it).Route_details.begin(), (*v_it).Route_details.end(), (*r_it)));
+                int index((int) distance((*v_it).Route_details.begin(), it));
+                if (it == (*v_it).Route_details.end()) {
+                    index = add_route_to_pool((*v_it), (*r_it), model, blockings, number_locations);
+                    enumerated.push_back(false);
+                }
+                enumerated[index] = true;
+            }
+            number_routes += (int) routes.size();
+        }
+        // restrict node to enumerated routes
+        for (auto r_it = (*v_it).All_routes.begin(); r_it != (*v_it).All_routes.end(); ++r_it) {
+            if (!enumerated[(*r_it)])
+                enumeration_node.Forbidden_vehicle_routes[(*v_it).Id].push_back((*r_it));
+        }
+    }
+    cout << "Enumeration: " << number_routes << " routes with reduced cost below " << rc_limit << endl;
+    // solve node as MIP over enumerated routes (keep the availabilities of the node's LP)
+    vector<VecI> available_routes;
+    vector<vector<VecI>> available_task_location_combinations;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        available_routes.push_back((*v_it).Available_routes);
+        available_task_location_combinations.push_back((*v_it).Available_task_location_combinations);
+    }
+    bool solved(solve_restricted_master_mip(ub, best_sol, enumeration_node, models, vehicles, locations, blockings, number_tasks, number_locations,
+                                            master_activity_end, mip_time_limit, time_limit, start_scenario));
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        (*v_it).Available_routes = available_routes[(*v_it).Id];
+        (*v_it).Available_task_location_combinations = available_task_location_combinations[(*v_it).Id];
+    }
+    return solved;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Write telemetry record of column generation iteration: master problem and pricing round. */
+void write_iteration_telemetry(Node &parent_node, int &cg_iteration, double &node_lb, GRBModel &master_problem, vector<vector<vector<VecI>>> &new_routes,
+        Pricing_statistics &statistics, double &time_master, double &time_pricing) {
+    VecI columns;
+    for (auto it = new_routes.begin(); it != new_routes.end(); ++it) {
+        columns.push_back((int) (*it).size());
+    }
+    Telemetry_record record;
+    start_telemetry_record(record, "iteration");
+    telemetry_field(record, "node", parent_node.Id);
+    telemetry_field(record, "depth", parent_node.Depth);
+    telemetry_field(record, "iteration", cg_iteration);
+    telemetry_field(record, "lp_bound", node_lb);
+    telemetry_field(record, "master_vars", master_problem.get(GRB_IntAttr_NumVars));
+    telemetry_field(record, "master_constrs", master_problem.get(GRB_IntAttr_NumConstrs));
+    telemetry_field(record, "columns", columns);
+    telemetry_field(record, "labels_created", statistics.Labels_created);
+    telemetry_field(record, "labels_dominated", statistics.Labels_dominated);
+    telemetry_field(record, "time_master", time_master);
+    telemetry_field(record, "time_pricing", time_pricing);
+    write_telemetry_record(record);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Solve node. node_is_complete is false if the time limit interrupts column generation (the node is not solved).*/
+void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &node_lb, bool &node_is_integral, bool &node_is_feasible, bool &node_is_complete, vector<VecD> &node_split_routes,
         vector<vector<VecD>> &node_split_usage, vector<vector<VecD>> &node_split_tasks, vector<vector<VecD>> &node_split_times,
-        Node parent_node, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, vector<vector<vector<VecI>>> &blockings,
-        vector<VecI> &transportation_times, int &number_tasks, int &number_locations, bool &master_activity_end, int &max_routes_per_vehicle,
-        double &time_limit, clock_t &start_scenario, double &time_create_mp, double &time_solve_mp, double &time_identify_cuts, double &time_read_duals, double &time_solve_sp, double &time_add_columns,
-        double &time_mip_search, double &time_sp_identify_extension, double &time_sp_perform_extension, double &time_sp_dominance_check_1, double &time_sp_dominance_check_2,
-        double &time_add_fragment, double &time_preprocess_node, double &time_postprocess_node, double &time_check_integrality_and_update_best) {
+        vector<VecI> &node_fixings, Node &parent_node, vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, vector<vector<vector<VecI>>> &blockings,
+        vector<VecI> &transportation_times, int &number_tasks, int &number_locations, Search_settings &settings, Pricing_scheduler &scheduler,
+        Time_point &start_scenario) {
     // prepare node
-    clock_t start_preprocess_node = clock();
+    Time_point start_node = wall_clock();
+    Pricing_statistics node_statistics = {};
+    double node_time_master(0), node_time_pricing(0), node_time_add_columns(0);
+    int node_columns(0);
+    PROFILE_BEGIN(preprocess_node_timer, "Preprocess_node");
     vector<vector<vector<VecI>>> available_blockings;
     preprocess_node(models, vehicles, locations, blockings, available_blockings, parent_node, number_tasks, number_locations, ub, horizon);
-    time_preprocess_node += double(clock() - start_preprocess_node) / CLOCKS_PER_SEC;
+    PROFILE_END(preprocess_node_timer);
 
     // build Master LP
-    clock_t start_create_mp = clock();
+    PROFILE_BEGIN(create_mp_timer, "Create_mp");
     // create Gurobi environment
     GRBEnv env = new GRBEnv();
     env.start();
@@ -36,22 +343,32 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
     vector<GRBVar> dummy;
     vector<VecI> active_ends;
     vector<vector<VecI>> zero_half_cuts;
-    create_master(master_activity_end, master_problem, segment_cycle_time, use_route, dummy, active_ends, vehicles, locations, number_locations, available_blockings, horizon);
-    time_create_mp += double(clock() - start_create_mp) / CLOCKS_PER_SEC;
+    create_master(settings.Master_activity_end, master_problem, segment_cycle_time, use_route, dummy, active_ends, vehicles, locations, number_locations, available_blockings, horizon);
+    PROFILE_END(create_mp_timer);
     int cg_iteration_count(1);
+    vector<VecD> block_cost;
+    future<Speculative_routes> speculation; // asynchronous pricing of the vehicles the last pricing round did not reach
     while (1) { // start column generation iterations
         // solve master problem
-        clock_t start_solve_mp = clock();
-        master_problem.set(GRB_DoubleParam_TimeLimit, max(0.0, double(time_limit - double(double(clock() - start_scenario) / CLOCKS_PER_SEC))));
+        PROFILE_BEGIN(solve_mp_timer, "Solve_mp");
+        Time_point start_master_round = wall_clock();
+        master_problem.set(GRB_DoubleParam_TimeLimit, max(0.0, settings.Time_limit - elapsed_seconds(start_scenario)));
         master_problem.optimize();
-        time_solve_mp += double(clock() - start_solve_mp) / CLOCKS_PER_SEC;
+        double master_round_time(elapsed_seconds(start_master_round));
+        node_time_master += master_round_time;
+        PROFILE_END(solve_mp_timer);
+        if (master_problem.get(GRB_IntAttr_Status) == 9) { // time limit: node is not solved and has to stay open
+            node_is_feasible = false;
+            node_is_complete = false;
+            return;
+        }
         if (master_problem.get(GRB_IntAttr_Status) != 2) {
             cout << "WARNING: Master problem is infeasible!" << endl;
             return;
         }
         node_lb = master_problem.get(GRB_DoubleAttr_ObjVal);
         // check if master LP solution is integral
-        clock_t start_check_integrality_and_update_best = clock();
+        PROFILE_BEGIN(check_integrality_and_update_best_timer, "Check_integrality_and_update_best");
         check_integrality(node_is_integral, vehicles, use_route);
         node_is_feasible = true;
         check_feasibility(node_is_feasible, vehicles, master_problem);
@@ -59,81 +376,127 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
         if (node_is_feasible && node_is_integral && (int) round(node_lb) < ub) {
             update_best(ub, node_lb, segment_cycle_time, best_sol, vehicles, use_route);
         }
-        time_check_integrality_and_update_best += double(clock() - start_check_integrality_and_update_best) / CLOCKS_PER_SEC;
+        PROFILE_END(check_integrality_and_update_best_timer);
         if (ub <= ub_escape) {
             break;
         }
         if (node_lb <= parent_node.Lb) {
             break;
         }
+        // limited number of iterations, e.g., for strong branching (0: no limit)
+        if (settings.Max_cg_iterations > 0 && cg_iteration_count >= settings.Max_cg_iterations) {
+            break;
+        }
         // derive master problem duals
-        clock_t start_read_duals = clock();
-        vector<VecD> block_cost;
+        PROFILE_BEGIN(read_duals_timer, "Read_duals");
+        block_cost.clear();
         VecD cut_cost;
         derive_duals(master_problem, vehicles, locations, block_cost, cut_cost, number_locations, horizon, available_blockings, zero_half_cuts);
-        time_read_duals += double(clock() - start_read_duals) / CLOCKS_PER_SEC;
+        PROFILE_END(read_duals_timer);
         // solve subproblems
-        clock_t start_solve_sp = clock();
+        PROFILE_BEGIN(solve_sp_timer, "Solve_sp");
         bool promising_route_found(false);
         vector<vector<VecI>> dummy;
         vector<vector<vector<VecI>>> new_routes(vehicles.size(), dummy);
         VecD dummy2({});
         vector<VecD> new_routes_cost(vehicles.size(), dummy2);
-        vector<Vehicle> shuffled_vehicles(vehicles);
-        random_shuffle(shuffled_vehicles.begin(), shuffled_vehicles.end());
-        int success(0);
-        for (auto v_it = shuffled_vehicles.begin(); v_it != shuffled_vehicles.end(); ++v_it) {
-            if (success >= 5)
+        Time_point start_pricing_round = wall_clock();
+        Pricing_statistics statistics = {};
+        VecI pricing_order;
+        order_pricing_vehicles(pricing_order, scheduler, vehicles, models);
+        int priced(0), success(0);
+        size_t next_vehicle(0);
+        for (; next_vehicle != pricing_order.size(); ++next_vehicle) {
+            if (success >= scheduler.Target)
                 break;
+            Vehicle &vehicle(vehicles[pricing_order[next_vehicle]]);
             vector<vector<VecI>> new_routes_v;
             VecD new_routes_cost_v;
-            if ((*v_it).Max_cost > models[(*v_it).Type].Min_sct * (*v_it).Sct_cost) {
-                find_new_routes(new_routes_v, new_routes_cost_v, (*v_it).Id, (*v_it), models[(*v_it).Type], locations, block_cost, cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, parent_node, ub, horizon,
-                                time_sp_identify_extension, time_sp_perform_extension, time_sp_dominance_check_1, time_sp_dominance_check_2, time_add_fragment);
+            if (vehicle.Max_cost > models[vehicle.Type].Min_sct * vehicle.Sct_cost) {
+                price_vehicle(scheduler.Engine, scheduler.Pulse_labels, new_routes_v, new_routes_cost_v, vehicle.Id, vehicle, models[vehicle.Type], locations, block_cost, cut_cost, zero_half_cuts, transportation_times, number_locations, number_tasks, parent_node, ub, horizon,
+                              statistics);
+                record_pricing_result(scheduler, vehicle, new_routes_cost_v);
+                ++priced;
                 if (new_routes_v.size() > 0) {
                     promising_route_found = true;
                     ++success;
                 }
-                if ((int) new_routes_v.size() > max_routes_per_vehicle) {
-                    struct route {
-                        int Id;
-                        vector<VecI> Route;
-                        double Cost;
-                    };
-                    vector<route> route_list_v;
-                    for (int x = 0; x != new_routes_v.size(); ++x) {
-                        route new_route;
-                        new_route.Id = x;
-                        new_route.Route = new_routes_v[x];
-                        new_route.Cost = new_routes_cost_v[x];
-                        route_list_v.push_back(new_route);
-                    }
-                    sort(route_list_v.begin(), route_list_v.end(), [](const auto &r1, const auto &r2) {return r1.Id < r2.Id;});
-                    sort(route_list_v.begin(), route_list_v.end(), [](const auto &r1, const auto &r2) {return r1.Cost < r2.Cost;});
-                    vector<vector<VecI>> new_new_routes_v;
-                    VecD new_new_routes_cost_v;
-                    int count = 0;
-                    for (auto it = route_list_v.begin(); it != route_list_v.end(); ++it, ++count) {
-                        if (count == max_routes_per_vehicle) {
-                            break;
-                        }
-                        new_new_routes_v.push_back((*it).Route);
-                        new_new_routes_cost_v.push_back((*it).Cost);
-                    }
-                    new_routes_v = new_new_routes_v;
-                    new_routes_cost_v = new_new_routes_cost_v;
+                select_routes(new_routes_v, new_routes_cost_v, settings.Max_routes_per_vehicle, scheduler.Column_selection, models[vehicle.Type], available_blockings, number_locations);
+            }
+            new_routes[vehicle.Id] = new_routes_v;
+            new_routes_cost[vehicle.Id] = new_routes_cost_v;
+        }
+        adapt_pricing_target(scheduler, priced, success);
+        // collect routes of asynchronous pricing on previous duals that have negative reduced cost for current duals
+        if (speculation.valid()) {
+            Speculative_routes speculative(speculation.get());
+            add_pricing_statistics(statistics, speculative.Statistics);
+            for (size_t i = 0; i != speculative.Vehicles.size(); ++i) {
+                Vehicle &vehicle(vehicles[speculative.Vehicles[i]]);
+                if (!new_routes[vehicle.Id].empty())
+                    continue;
+                for (auto r_it = speculative.New_routes[i].begin(); r_it != speculative.New_routes[i].end(); ++r_it) {
+                    double reduced_cost(route_reduced_cost((*r_it), vehicle, models[vehicle.Type], block_cost, cut_cost, zero_half_cuts, number_locations));
+                    if (reduced_cost > -PRECISION)
+                        continue;
+                    // existing routes are already in the master problem
+                    if (find(vehicle.Route_details.begin(), vehicle.Route_details.end(), (*r_it)) != vehicle.Route_details.end())
+                        continue;
+                    new_routes[vehicle.Id].push_back((*r_it));
+                    new_routes_cost[vehicle.Id].push_back(reduced_cost + vehicle.Max_cost);
+                    promising_route_found = true;
                 }
             }
-            new_routes[(*v_it).Id] = new_routes_v;
-            new_routes_cost[(*v_it).Id] = new_routes_cost_v;
         }
-        time_solve_sp += double(clock() - start_solve_sp) / CLOCKS_PER_SEC;
+        // offer time-shifted copies of new routes to the other vehicles of the same model
+        if (scheduler.Transfer && promising_route_found) {
+            transfer_routes(new_routes, new_routes_cost, models, vehicles, locations, parent_node, block_cost, cut_cost, zero_half_cuts,
+                            number_tasks, number_locations, ub, settings.Max_routes_per_vehicle);
+        }
+        // price vehicles not reached by this round on its duals while the master problem is re-optimized
+        if (scheduler.Async && promising_route_found && next_vehicle != pricing_order.size()) {
+            vector<Vehicle> snapshots;
+            for (size_t o = next_vehicle; o != pricing_order.size(); ++o) {
+                Vehicle &vehicle(vehicles[pricing_order[o]]);
+                if (vehicle.Max_cost > models[vehicle.Type].Min_sct * vehicle.Sct_cost)
+                    snapshots.push_back(pricing_snapshot(vehicle));
+            }
+            if (!snapshots.empty()) {
+                speculation = async(launch::async, price_speculatively, move(snapshots), block_cost, cut_cost, zero_half_cuts, ref(models), ref(locations),
+                                    ref(transportation_times), number_locations, number_tasks, ref(parent_node), ub, horizon, settings.Max_routes_per_vehicle,
+                                    scheduler.Engine, scheduler.Pulse_labels);
+            }
+        }
+        PROFILE_END(solve_sp_timer);
+        double pricing_round_time(elapsed_seconds(start_pricing_round));
+        node_time_pricing += pricing_round_time;
+        add_pricing_statistics(node_statistics, statistics);
+        for (auto it = new_routes.begin(); it != new_routes.end(); ++it) {
+            node_columns += (int) (*it).size();
+        }
+        if (telemetry_enabled())
+            write_iteration_telemetry(parent_node, cg_iteration_count, node_lb, master_problem, new_routes, statistics, master_round_time, pricing_round_time);
 
         if (!promising_route_found) { // exit loop if no more promising routes
+            // duals are optimal for the node's LP relaxation: remove columns that cannot improve ub in subtree
+            if (settings.Reduced_cost_fixing && node_is_feasible && !node_is_integral) {
+                fix_by_reduced_cost(node_fixings, node_lb, ub, models, vehicles, locations, block_cost, number_locations, horizon);
+            }
+            // small gap: solve node by route enumeration instead of branching (node_lb = ub closes the node)
+            if (settings.Enumeration_gap > 0 && node_is_feasible && !node_is_integral && ub > ub_escape && ub - node_lb <= settings.Enumeration_gap
+                && elapsed_seconds(start_scenario) < settings.Time_limit) {
+                PROFILE_SCOPE("Enumeration");
+                if (solve_node_by_enumeration(ub, best_sol, node_lb, parent_node, models, vehicles, locations, blockings, block_cost, cut_cost, zero_half_cuts,
+                                              transportation_times, number_tasks, number_locations, horizon, settings.Master_activity_end, settings.Enumeration_routes,
+                                              settings.Enumeration_time_limit, settings.Time_limit, start_scenario)) {
+                    node_lb = max(node_lb, (double) ub);
+                }
+            }
             break;
         }
         // add columns
-        clock_t start_add_columns = clock();
+        PROFILE_BEGIN(add_columns_timer, "Add_columns");
+        Time_point start_add_columns = wall_clock();
         for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
             for (size_t x = 0; x != new_routes[(*v_it).Id].size(); ++x) {
                 Model model(models[(*v_it).Type]);
@@ -187,13 +550,8 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
                 (*v_it).Available_routes.push_back(index);
                 (*v_it).Route_details.push_back(new_routes[(*v_it).Id][x]);
                 (*v_it).Route_scts.push_back((int) round(new_routes[(*v_it).Id][x].back()[2] - (*v_it).Arrival_time));
-                VecI start_times(number_locations, 0);
-                VecI end_times(number_locations, 0);
-                for (auto it = new_routes[(*v_it).Id][x].begin(); it != new_routes[(*v_it).Id][x].end(); ++it) {
-                    start_times[(*it)[0]] = (int) round((*it)[2]);
-                    end_times[(*it)[0]] = (int) round((*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]]);
-                }
-
+                VecI start_times, end_times;
+                route_location_times(start_times, end_times, new_routes[(*v_it).Id][x], model, number_locations);
                 (*v_it).Route_start_times.push_back(start_times);
                 (*v_it).Route_end_times.push_back(end_times);
                 // create new column in master problem
@@ -203,7 +561,7 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
                 for (int zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
                     int collide(0);
                     for (auto c = zero_half_cuts[zhc].begin(); c != zero_half_cuts[zhc].end(); ++c) {
-                        if ((*v_it).Route_start_times.back()[(*c)[0]] <= (*c)[1] && (*v_it).Route_end_times.back()[(*c)[0]] > (*c)[1]) {
+                        if ((*v_it).Route_start_times[index][(*c)[0]] <= (*c)[1] && (*v_it).Route_end_times[index][(*c)[0]] > (*c)[1]) {
                             ++collide;
                         }
                     }
@@ -211,7 +569,7 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
                         column.addTerm(1, master_problem.getConstrByName("cstr_cut_" + to_string(zhc)));
                     }
                 }
-                if (master_activity_end) {
+                if (settings.Master_activity_end) {
                     // update existing block constraints with new activity
                     for (auto it = new_routes[(*v_it).Id][x].begin(); it != new_routes[(*v_it).Id][x].end(); ++it) {
                         if ((*it)[0] != 0 && (*it)[0] != number_locations - 1) {
@@ -262,10 +620,14 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
                 master_problem.update();
             }
         }
-        time_add_columns += double(clock() - start_add_columns) / CLOCKS_PER_SEC;
+        PROFILE_END(add_columns_timer);
+        node_time_add_columns += elapsed_seconds(start_add_columns);
         ++cg_iteration_count;
     }
-    clock_t start_postprocessing_node = clock();
+    // discard pending asynchronous pricing
+    if (speculation.valid())
+        speculation.wait();
+    PROFILE_BEGIN(postprocess_node_timer, "Postprocess_node");
     int total_routes(0);
     for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
         total_routes += (int) (*v_it).Available_routes.size();
@@ -280,7 +642,46 @@ void solve_node(int &horizon, int &ub, int &ub_escape, VecI &best_sol, double &n
     find_split_tasks_and_times(node_split_tasks, node_split_times, models, vehicles, master_problem, number_locations, number_tasks, horizon);
     // derive current vehicle scts
     derive_vehicle_scts(vehicles, master_problem);
-    time_postprocess_node += double(clock() - start_postprocessing_node) / CLOCKS_PER_SEC;
+    PROFILE_END(postprocess_node_timer);
+    // routes are integral without timings: determine best timings of route sequences using time-continuous MIP
+    if (settings.Route_mip_time_limit > 0 && node_is_feasible && !node_is_integral && ub > ub_escape) {
+        bool node_is_integral_without_timings(true);
+        VecI used_routes_without_timings;
+        check_integrality_of_routes_without_timings(node_is_integral_without_timings, used_routes_without_timings, vehicles, node_split_routes);
+        if (node_is_integral_without_timings) {
+            PROFILE_SCOPE("Mip_search");
+            double mip_time_limit(min(settings.Time_limit, elapsed_seconds(start_scenario) + settings.Route_mip_time_limit));
+            bool warmstart(false);
+            bool nf(false);
+            solve_timecontinuous_mip_ub(ub, best_sol, models, vehicles, locations, transportation_times, number_locations, used_routes_without_timings,
+                                        blockings, mip_time_limit, start_scenario, warmstart, nf);
+        }
+    }
     horizon = vehicles.back().Arrival_time + ub;
+    string memory_source(thread_memory_source());
+    sample_memory(memory_source, "Labels", node_statistics.Peak_label_bytes);
+    sample_memory(memory_source, "Master", master_bytes(master_problem));
+    if (telemetry_enabled()) {
+        Telemetry_record record;
+        start_telemetry_record(record, "node");
+        telemetry_field(record, "node", parent_node.Id);
+        telemetry_field(record, "depth", parent_node.Depth);
+        telemetry_field(record, "cg_limit", settings.Max_cg_iterations);
+        telemetry_field(record, "iterations", cg_iteration_count);
+        telemetry_field(record, "lp_bound", node_lb);
+        telemetry_field(record, "ub", ub);
+        telemetry_field(record, "feasible", node_is_feasible);
+        telemetry_field(record, "integral", node_is_integral);
+        telemetry_field(record, "master_vars", master_problem.get(GRB_IntAttr_NumVars));
+        telemetry_field(record, "master_constrs", master_problem.get(GRB_IntAttr_NumConstrs));
+        telemetry_field(record, "columns", node_columns);
+        telemetry_field(record, "labels_created", node_statistics.Labels_created);
+        telemetry_field(record, "labels_dominated", node_statistics.Labels_dominated);
+        telemetry_field(record, "time_master", node_time_master);
+        telemetry_field(record, "time_pricing", node_time_pricing);
+        telemetry_field(record, "time_add_columns", node_time_add_columns);
+        telemetry_field(record, "time_node", elapsed_seconds(start_node));
+        write_telemetry_record(record);
+    }
 }
 //------------------------------------------------------------------------------------------------------------//
\ No newline at end of file
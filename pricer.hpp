@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Pricing engines for the subproblem of a vehicle.
+ * LABELING: labeling algorithm (find_new_routes).
+ * PULSE: depth-first pulse search. Extensions are identified as in the labeling algorithm, which already prunes route
+ * fragments that cannot reach negative reduced cost or finish below ub. In addition, a fragment is pruned if it is
+ * dominated by a fragment explored before at its location. At most Max_labels fragments are kept per location, so
+ * the memory of the search is bounded by Max_labels times the number of locations plus the current path.
+ * RACE: labeling algorithm and pulse search run on separate threads; the engine that finishes first stops the other.*/
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Pulse_search {
+    vector<vector<Route_fragment>> Labels; // explored route fragments per location
+    int Max_labels; // maximum number of explored route fragments kept per location
+    Pricing_statistics Statistics; // created and dominated route fragments
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Extend route fragment depth-first, cheapest extension first. */
+void pulse(Route_fragment &parent, Pulse_search &search, vector<vector<VecI>> &new_routes, VecD &new_routes_cost, int &v_id, Vehicle &vehicle,
+           Model &model, vector<Location> &locations, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts,
+           vector<VecI> &transportation_times, int &number_locations, int &number_tasks, Node &parent_node, int &ub, atomic<bool> &stop) {
+    if (stop)
+        return;
+    double rc_limit(0.0);
+    bool enumerate(false);
+    vector<Candidate> candidates;
+    identify_extension_candidates(candidates, parent, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                                  number_locations, number_tasks, parent_node, ub, rc_limit, enumerate);
+    stable_sort(candidates.begin(), candidates.end(), [](const auto &c1, const auto &c2) {return c1.Add_cost < c2.Add_cost;});
+    for (auto c_it = candidates.begin(); c_it != candidates.end(); ++c_it) {
+        Route_fragment new_fragment;
+        ++search.Statistics.Labels_created;
+        if (extend_route_fragment(new_fragment, parent, (*c_it), model, locations, number_locations, zero_half_cuts)) {
+            if (find(new_fragment.Missing_tasks.begin(), new_fragment.Missing_tasks.end(), true) == new_fragment.Missing_tasks.end()) {
+                new_routes.push_back(new_fragment.Route);
+                new_routes_cost.push_back(new_fragment.Cost);
+            }
+            continue;
+        }
+        // prune fragment dominated by explored fragment at its location
+        vector<Route_fragment> &labels(search.Labels[new_fragment.Loc]);
+        if (!check_dominance1(labels, new_fragment, number_tasks, number_locations, vehicle.Sct_cost, cut_cost)) {
+            ++search.Statistics.Labels_dominated;
+            continue;
+        }
+        if ((int) labels.size() < search.Max_labels)
+            labels.push_back(new_fragment);
+        pulse(new_fragment, search, new_routes, new_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts,
+              transportation_times, number_locations, number_tasks, parent_node, ub, stop);
+        if (stop)
+            return;
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Find new promising routes for a vehicle by pulse search. The search ends early if stop is set. */
+void find_new_routes_pulse(vector<vector<VecI>> &new_routes, VecD &new_routes_cost, int &v_id, Vehicle &vehicle, Model &model, vector<Location> &locations,
+                           vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times, int &number_locations,
+                           int &number_tasks, Node &parent_node, int &ub, int &max_labels, atomic<bool> &stop, Pricing_statistics &statistics) {
+    Route_fragment root;
+    initialize_root_route_fragment(root, model, vehicle, number_locations, zero_half_cuts);
+    Pulse_search search;
+    search.Labels.assign(number_locations, {});
+    search.Max_labels = max_labels;
+    search.Statistics = {};
+    pulse(root, search, new_routes, new_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts,
+          transportation_times, number_locations, number_tasks, parent_node, ub, stop);
+    for (auto l_it = search.Labels.begin(); l_it != search.Labels.end(); ++l_it) {
+        for (auto it = (*l_it).begin(); it != (*l_it).end(); ++it) {
+            search.Statistics.Peak_label_bytes += route_fragment_bytes(*it);
+        }
+    }
+    add_pricing_statistics(statistics, search.Statistics);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Find new promising routes for a vehicle with pricing engine LABELING, PULSE, or RACE. The work of all engines that
+ * ran is added to statistics. */
+void price_vehicle(string &engine, int &max_labels, vector<vector<VecI>> &new_routes, VecD &new_routes_cost, int &v_id, Vehicle &vehicle, Model &model,
+                   vector<Location> &locations, vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times,
+                   int &number_locations, int &number_tasks, Node &parent_node, int &ub, int &horizon, Pricing_statistics &statistics) {
+    atomic<bool> stop(false);
+    double rc_limit(0.0);
+    bool enumerate(false);
+    int route_limit(0);
+    if (engine == "PULSE") {
+        PROFILE_SCOPE("Sp_pulse");
+        find_new_routes_pulse(new_routes, new_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                              number_locations, number_tasks, parent_node, ub, max_labels, stop, statistics);
+    }
+    else if (engine == "RACE") {
+        atomic<int> winner(-1); // 0: labeling, 1: pulse search
+        vector<vector<VecI>> labeling_routes;
+        VecD labeling_routes_cost;
+        Pricing_statistics labeling_statistics = {};
+        future<void> labeling = async(launch::async, [&]() {
+            find_new_routes(labeling_routes, labeling_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                            number_locations, number_tasks, parent_node, ub, horizon, rc_limit, enumerate, route_limit, stop, labeling_statistics);
+            int none(-1);
+            if (winner.compare_exchange_strong(none, 0))
+                stop = true;
+        });
+        vector<vector<VecI>> pulse_routes;
+        VecD pulse_routes_cost;
+        find_new_routes_pulse(pulse_routes, pulse_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                              number_locations, number_tasks, parent_node, ub, max_labels, stop, statistics);
+        int none(-1);
+        if (winner.compare_exchange_strong(none, 1))
+            stop = true;
+        labeling.wait();
+        add_pricing_statistics(statistics, labeling_statistics);
+        if (winner == 0) {
+            new_routes = labeling_routes;
+            new_routes_cost = labeling_routes_cost;
+        }
+        else {
+            new_routes = pulse_routes;
+            new_routes_cost = pulse_routes_cost;
+        }
+    }
+    else {
+        find_new_routes(new_routes, new_routes_cost, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                        number_locations, number_tasks, parent_node, ub, horizon, rc_limit, enumerate, route_limit, stop, statistics);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Order of vehicles in the pricing rounds of column generation.
+ * Vehicles are ranked by their potential to yield routes with negative reduced cost: the dual bound
+ * Max_cost - Min_sct * Sct_cost (no route of the vehicle has a reduced cost below its negative) and a moving average
+ * of the most negative reduced cost found in the vehicle's recent pricing calls. Ties are broken randomly.
+ * A pricing round stops once Target vehicles produced routes. Target is adapted after each round on the share of priced
+ * vehicles that produced routes (not on times, so the rounds are reproducible for a seed): if every priced vehicle
+ * produced routes, a round collects columns of more vehicles; if less than half of them did, fewer.
+ * With asynchronous pricing, the vehicles a round did not reach are priced on the round's duals while the master
+ * problem is re-optimized.*/
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Pricing_scheduler {
+    mt19937 Generator; // random number generator for breaking ties between vehicles
+    VecD History; // moving average of the most negative reduced cost per vehicle (0: no route found)
+    VecB Priced; // vehicle was priced before
+    int Target; // number of vehicles with new routes after which a pricing round stops
+    int Max_target; // maximum target: number of vehicles
+    bool Async; // price vehicles not reached by a round asynchronously during the next master solve
+    string Column_selection; // selection of new routes of a vehicle: MOST_NEGATIVE, DIVERSE, or MIXED
+    bool Transfer; // offer time-shifted copies of new routes to the other vehicles of the same model
+    string Engine; // pricing engine: LABELING, PULSE, or RACE
+    int Pulse_labels; // pulse search: maximum number of explored route fragments kept per location
+};
+//------------------------------------------------------------------------------------------------------------//
+void initialize_pricing_scheduler(Pricing_scheduler &scheduler, int number_vehicles, int seed, int initial_target, bool async, string &column_selection, bool transfer,
+        string &engine, int pulse_labels) {
+    scheduler.Generator.seed((unsigned) seed);
+    scheduler.History.assign(number_vehicles, 0.0);
+    scheduler.Priced.assign(number_vehicles, false);
+    scheduler.Max_target = max(1, number_vehicles);
+    scheduler.Target = min(scheduler.Max_target, max(1, initial_target));
+    scheduler.Async = async;
+    scheduler.Column_selection = column_selection;
+    scheduler.Transfer = transfer;
+    scheduler.Engine = engine;
+    scheduler.Pulse_labels = pulse_labels;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Pricing score of vehicle: dual bound if the vehicle was not priced before, else mean of dual bound and history. */
+double pricing_score(Pricing_scheduler &scheduler, Vehicle &vehicle, Model &model) {
+    double dual_bound(vehicle.Max_cost - model.Min_sct * vehicle.Sct_cost);
+    if (!scheduler.Priced[vehicle.Id])
+        return dual_bound;
+    return 0.5 * (dual_bound - scheduler.History[vehicle.Id]);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Order vehicle identifiers by decreasing pricing score for the current duals. */
+void order_pricing_vehicles(VecI &order, Pricing_scheduler &scheduler, vector<Vehicle> &vehicles, vector<Model> &models) {
+    order.clear();
+    VecD score(vehicles.size(), 0.0);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        order.push_back((*v_it).Id);
+        score[(*v_it).Id] = pricing_score(scheduler, (*v_it), models[(*v_it).Type]);
+    }
+    shuffle(order.begin(), order.end(), scheduler.Generator);
+    stable_sort(order.begin(), order.end(), [&score](const int &v1, const int &v2) {return score[v1] > score[v2];});
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Update history of vehicle with the route costs of a pricing call (reduced cost = cost - Max_cost). */
+void record_pricing_result(Pricing_scheduler &scheduler, Vehicle &vehicle, VecD &new_routes_cost) {
+    double best(0.0);
+    for (auto it = new_routes_cost.begin(); it != new_routes_cost.end(); ++it) {
+        best = min(best, (*it) - vehicle.Max_cost);
+    }
+    if (scheduler.Priced[vehicle.Id])
+        scheduler.History[vehicle.Id] = 0.5 * (scheduler.History[vehicle.Id] + best);
+    else
+        scheduler.History[vehicle.Id] = best;
+    scheduler.Priced[vehicle.Id] = true;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Adapt target of pricing rounds to the number of vehicles priced in the last round and the number of them with new routes. */
+void adapt_pricing_target(Pricing_scheduler &scheduler, int priced, int success) {
+    if (priced == 0)
+        return;
+    if (success == priced)
+        scheduler.Target = min(scheduler.Max_target, scheduler.Target + 1);
+    else if (2 * success < priced)
+        scheduler.Target = max(1, scheduler.Target - 1);
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Hierarchical profiler of the solution phases. It is compiled only with PROFILING (CMake option PROFILING);
+ * otherwise the profiling macros expand to nothing.
+ * PROFILE_SCOPE(name) times the enclosing block, PROFILE_BEGIN(timer, name) and PROFILE_END(timer) time a section
+ * within a block. Timings are nested: a phase started while another phase is running is recorded as its child.
+ * Time is read from the time stamp counter (wall clock without system call; steady clock on other architectures).
+ * Each thread records into its own thread_local tree, which is merged into the total tree when the thread ends, so
+ * the reported times are summed over all threads. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+#ifdef PROFILING
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name) Scoped_timer PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#define PROFILE_BEGIN(timer, name) Scoped_timer timer(name)
+#define PROFILE_END(timer) timer.stop()
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_BEGIN(timer, name)
+#define PROFILE_END(timer)
+#endif
+//------------------------------------------------------------------------------------------------------------//
+#ifdef PROFILING
+struct Profile_node {
+    const char *Name; // phase name (string literal)
+    int Parent; // index of parent phase (-1 for the root)
+    vector<pair<const char *, int>> Children; // child phases by name
+    uint64_t Ticks; // summed duration in ticks
+    uint64_t Calls; // number of timings
+};
+//------------------------------------------------------------------------------------------------------------//
+struct Profile_tree {
+    vector<Profile_node> Nodes; // phases; index 0 is the root
+    int Current; // running phase
+    Profile_tree();
+    ~Profile_tree();
+};
+//------------------------------------------------------------------------------------------------------------//
+uint64_t profile_ticks() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#else
+    return (uint64_t) chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Ticks per second: time stamp counter calibrated against the steady clock since the first call. */
+double profile_ticks_per_second() {
+    static const uint64_t start_ticks(profile_ticks());
+    static const Time_point start_time(wall_clock());
+    Time_point start(start_time);
+    double seconds(elapsed_seconds(start));
+    if (seconds < 0.001)
+        return 1e9;
+    return double(profile_ticks() - start_ticks) / seconds;
+}
+//------------------------------------------------------------------------------------------------------------//
+Profile_tree::Profile_tree() {
+    Nodes.push_back({"Total", -1, {}, 0, 0});
+    Current = 0;
+    profile_ticks_per_second();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Child of phase with name (created if it does not exist). */
+int profile_child(Profile_tree &tree, int parent, const char *name) {
+    for (auto it = tree.Nodes[parent].Children.begin(); it != tree.Nodes[parent].Children.end(); ++it) {
+        if ((*it).first == name || strcmp((*it).first, name) == 0)
+            return (*it).second;
+    }
+    int child((int) tree.Nodes.size());
+    tree.Nodes.push_back({name, parent, {}, 0, 0});
+    tree.Nodes[parent].Children.push_back({name, child});
+    return child;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Add phase node of tree source (with its subtree) to phase node of tree target. */
+void merge_profile(Profile_tree &target, int target_node, Profile_tree &source, int source_node) {
+    target.Nodes[target_node].Ticks += source.Nodes[source_node].Ticks;
+    target.Nodes[target_node].Calls += source.Nodes[source_node].Calls;
+    for (auto it = source.Nodes[source_node].Children.begin(); it != source.Nodes[source_node].Children.end(); ++it) {
+        int child(profile_child(target, target_node, (*it).first));
+        merge_profile(target, child, source, (*it).second);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+mutex &profile_mutex() {
+    static mutex total_mutex;
+    return total_mutex;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Phases of all ended threads. */
+Profile_tree &total_profile() {
+    static Profile_tree total;
+    return total;
+}
+//------------------------------------------------------------------------------------------------------------//
+Profile_tree &thread_profile() {
+    thread_local Profile_tree tree;
+    return tree;
+}
+//------------------------------------------------------------------------------------------------------------//
+Profile_tree::~Profile_tree() {
+    if (this == &total_profile())
+        return;
+    lock_guard<mutex> lock(profile_mutex());
+    merge_profile(total_profile(), 0, *this, 0);
+}
+//------------------------------------------------------------------------------------------------------------//
+struct Scoped_timer {
+    Profile_tree *Tree; // profile of the thread
+    int Node; // timed phase
+    uint64_t Start; // ticks at start
+    bool Running; // phase is timed
+    Scoped_timer(const char *name) {
+        Tree = &thread_profile();
+        Node = profile_child(*Tree, Tree->Current, name);
+        Tree->Current = Node;
+        Running = true;
+        Start = profile_ticks();
+    }
+    void stop() {
+        if (!Running)
+            return;
+        Profile_node &node(Tree->Nodes[Node]);
+        node.Ticks += profile_ticks() - Start;
+        ++node.Calls;
+        Tree->Current = node.Parent;
+        Running = false;
+    }
+    ~Scoped_timer() {
+        stop();
+    }
+};
+//------------------------------------------------------------------------------------------------------------//
+void print_profile_node(Profile_tree &tree, int node, int depth, double ticks_per_second) {
+    for (auto it = tree.Nodes[node].Children.begin(); it != tree.Nodes[node].Children.end(); ++it) {
+        Profile_node &child(tree.Nodes[(*it).second]);
+        double parent_ticks(tree.Nodes[node].Ticks > 0 ? (double) tree.Nodes[node].Ticks : 0.0);
+        cout << string(2 * depth, ' ') << child.Name << ": " << double(child.Ticks) / ticks_per_second << " seconds, " << child.Calls << " calls";
+        if (parent_ticks > 0)
+            cout << " (" << round(double(child.Ticks) / parent_ticks * 1000) / 10.0 << "%)";
+        cout << endl;
+        print_profile_node(tree, (*it).second, depth + 1, ticks_per_second);
+    }
+}
+#endif
+//------------------------------------------------------------------------------------------------------------//
+/* Print phases of all ended threads and of the calling thread (times summed over threads). */
+void print_profile() {
+#ifdef PROFILING
+    Profile_tree report;
+    {
+        lock_guard<mutex> lock(profile_mutex());
+        merge_profile(report, 0, total_profile(), 0);
+    }
+    merge_profile(report, 0, thread_profile(), 0);
+    cout << "Profile (summed over threads):" << endl;
+    print_profile_node(report, 0, 0, profile_ticks_per_second());
+    // report is a local tree: keep it out of the total
+    report.Nodes.clear();
+    report.Nodes.push_back({"Total", -1, {}, 0, 0});
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Reset phases of all ended threads and of the calling thread, e.g., after a report. Phases of the calling thread
+ * are zeroed in place, so phases that are still running remain valid. */
+void reset_profile() {
+#ifdef PROFILING
+    {
+        lock_guard<mutex> lock(profile_mutex());
+        total_profile().Nodes.clear();
+        total_profile().Nodes.push_back({"Total", -1, {}, 0, 0});
+        total_profile().Current = 0;
+    }
+    Profile_tree &tree(thread_profile());
+    for (auto it = tree.Nodes.begin(); it != tree.Nodes.end(); ++it) {
+        (*it).Ticks = 0;
+        (*it).Calls = 0;
+    }
+#endif
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -22,6 +22,31 @@ struct Node {
     vector<VecI> Task_start_times_upper_bounds; // Upper bounds on the vehicles' task start times
     vector<vector<VecI>> Enforced_vehicle_location_times; // enforced location times for the vehicles
     vector<vector<VecI>> Forbidden_vehicle_location_times; // forbidden location times for the vehicles
+    vector<VecI> Forbidden_vehicle_routes; // routes of the vehicles excluded from the node (route enumeration)
+    vector<vector<VecI>> Forbidden_vehicle_location_combinations; // task-location combinations of the vehicles removed by reduced-cost fixing
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Branching decision that distinguishes a node from its parent node. */
+struct Branching_decision {
+    int Family; // branching family: 0 (ASSIGN), 1 (USAGE), 2 (TIME), or -1 for the root node
+    int Direction; // 0 for down branch (left), 1 for up branch (right)
+    int Vehicle; // vehicle identifier
+    int Index; // location (ASSIGN, USAGE) or task (TIME)
+    int Value; // task (ASSIGN) or time (USAGE, TIME)
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Open node in B&B tree. It only stores the branching decision with respect to its parent node; the full node
+ * is derived from the root node when the node is solved. */
+struct Open_node {
+    int Id; // node identifier
+    double Lb; // lower bound
+    int Depth; // depth of node in tree
+    int Preference; // cumulative branching preference, i.e., how often was branched in the "favorable" direction
+    shared_ptr<const Open_node> Parent; // parent node (empty for root node)
+    Branching_decision Decision; // branching decision that derives node from parent node
+    double Fractionality; // fractional value of branching variable in parent node that is removed by branching decision
+    vector<VecI> Fixings; // reduced-cost fixings of the solved node that hold for its subtree: {vehicle, location, combination}
+    int Fixings_ub; // ub for which the fixings were derived (they only hold while ub is not larger)
 };
 //------------------------------------------------------------------------------------------------------------//
 /* A route fragment shows a partial route with the corresponding properties. */
@@ -49,6 +74,230 @@ struct Candidate {
     VecI Visit_ZHC_Change; // new visits of zero-half cut location-time combinations in route extension
 };
 //------------------------------------------------------------------------------------------------------------//
+/* Work of the pricing algorithms (labels are route fragments). */
+struct Pricing_statistics {
+    long long Labels_created; // route fragments created by extension
+    long long Labels_dominated; // route fragments discarded by dominance
+    size_t Peak_label_bytes; // peak memory of the kept route fragments
+};
+//------------------------------------------------------------------------------------------------------------//
+void add_pricing_statistics(Pricing_statistics &total, Pricing_statistics &statistics) {
+    total.Labels_created += statistics.Labels_created;
+    total.Labels_dominated += statistics.Labels_dominated;
+    total.Peak_label_bytes = max(total.Peak_label_bytes, statistics.Peak_label_bytes);
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Memory of a route fragment including its vectors. */
+size_t route_fragment_bytes(Route_fragment &fragment) {
+    size_t bytes(sizeof(Route_fragment) + fragment.Route.capacity() * sizeof(VecI) + fragment.Visits_ZHC.capacity() * sizeof(int)
+                 + (fragment.Missing_tasks.capacity() + fragment.Accessible_locations.capacity()) / 8);
+    for (auto it = fragment.Route.begin(); it != fragment.Route.end(); ++it) {
+        bytes += (*it).capacity() * sizeof(int);
+    }
+    return bytes;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Initialize root node for scenarios. */
+void root_node(vector<vector<VecI>> &fixed_vlt, vector<vector<VecI>> &enforced_vlz, vector<vector<VecI>> &forbidden_vlz, vector<VecI> &start_lb, vector<VecI> &start_ub,
+        vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, int &number_locations, int &number_tasks, int &horizon) {
+    // initialize fixed vlt
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        VecI dummy_vector(number_tasks, -1);
+        vector<VecI> location_task_assignments(number_locations, dummy_vector);
+        fixed_vlt.push_back(location_task_assignments);
+    }
+    // initialize enforced and forbidden vlz
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        VecI dummy({});
+        vector<VecI> enforced_v(number_locations, dummy);
+        vector<VecI> forbidden_v(number_locations, dummy);
+        enforced_vlz.push_back(enforced_v);
+        forbidden_vlz.push_back(forbidden_v);
+    }
+    // initialize lower bounds on starting times of tasks
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        VecI start_lb_v(number_tasks, 0);
+        start_lb.push_back(start_lb_v);
+    }
+    // initialize upper bounds on starting times of tasks
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        VecI start_ub_v(number_tasks, horizon);
+        start_ub.push_back(start_ub_v);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Set data entries for root node. */
+void initialize_root_node(Node &root, vector<vector<VecI>> &fixed_vlt, vector<vector<VecI>> &enforced_vlz,
+        vector<vector<VecI>> &forbidden_vlz, vector<VecI> &start_lb, vector<VecI> &start_ub, vector<Model> &models, vector<Vehicle> &vehicles) {
+    root.Id = 0;
+    int max_min_sct(0);
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        if (models[(*v_it).Type].Min_sct > max_min_sct) {
+            max_min_sct = models[(*v_it).Type].Min_sct;
+        }
+    }
+    root.Lb = max_min_sct;
+    root.Depth = 0;
+    root.Preference = 0;
+    root.Fixed_vehicle_location_tasks = fixed_vlt;
+    root.Enforced_vehicle_location_times = enforced_vlz;
+    root.Forbidden_vehicle_location_times = forbidden_vlz;
+    root.Task_start_times_lower_bounds = start_lb;
+    root.Task_start_times_upper_bounds = start_ub;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        root.Forbidden_vehicle_routes.push_back({});
+        root.Forbidden_vehicle_location_combinations.push_back(vector<VecI>(fixed_vlt[(*v_it).Id].size()));
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Determine task-location combinations available for all vehicles in node (scenario, reduced-cost fixing, and fixed tasks). */
+void determine_available_combinations(vector<Model> &models, vector<Vehicle> &vehicles, vector<Location> &locations, Node &parent_node,
+        int &number_tasks, int &number_locations) {
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        // reset available task-location combinations
+        VecI dummy({});
+        vector<VecI> reset_ltc(number_locations, dummy);
+        (*v_it).Available_task_location_combinations = reset_ltc;
+        Model model(*(models.begin() + (*v_it).Type));
+        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+            for (size_t c_index = 0; c_index != model.Possible_task_location_combinations[(*l_it).Id].size(); ++c_index) {
+                int c((int) c_index);
+                if (find(model.Scenario_task_location_combinations[(*l_it).Id].begin(), model.Scenario_task_location_combinations[(*l_it).Id].end(), c) == model.Scenario_task_location_combinations[(*l_it).Id].end())
+                    continue;
+                if (find(parent_node.Forbidden_vehicle_location_combinations[(*v_it).Id][(*l_it).Id].begin(), parent_node.Forbidden_vehicle_location_combinations[(*v_it).Id][(*l_it).Id].end(), c) != parent_node.Forbidden_vehicle_location_combinations[(*v_it).Id][(*l_it).Id].end())
+                    continue;
+                bool feasible_c(true);
+                for (int t = 0; t != number_tasks; ++t) {
+                    if (parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*l_it).Id][t] != -1 && (int) model.Possible_task_location_combinations[(*l_it).Id][c_index][t] != parent_node.Fixed_vehicle_location_tasks[(*v_it).Id][(*l_it).Id][t]) {
+                        feasible_c = false;
+                        break;
+                    }
+                }
+                if (!feasible_c)
+                    continue;
+                (*v_it).Available_task_location_combinations[(*l_it).Id].push_back(c);
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Apply branching decision to node. */
+void apply_branching_decision(Node &node, const Branching_decision &decision, vector<Vehicle> &vehicles, vector<Location> &locations) {
+    if (decision.Family == 0) {
+        if (decision.Direction == 0) {
+            // down branch: task not to be performed on location
+            node.Fixed_vehicle_location_tasks[decision.Vehicle][decision.Index][decision.Value] = 0;
+        }
+        else {
+            // up branch: task to be performed on location
+            node.Fixed_vehicle_location_tasks[decision.Vehicle][decision.Index][decision.Value] = 1;
+            for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+                if ((*l_it).Id != decision.Index && (*l_it).Assignments[decision.Value]) {
+                    node.Fixed_vehicle_location_tasks[decision.Vehicle][(*l_it).Id][decision.Value] = 0;
+                }
+            }
+        }
+    }
+    else if (decision.Family == 1) {
+        if (decision.Direction == 0) {
+            // down branch: vehicle does not block location at time z
+            node.Forbidden_vehicle_location_times[decision.Vehicle][decision.Index].push_back(decision.Value);
+        }
+        else {
+            // up branch: vehicle blocks location at time z
+            node.Enforced_vehicle_location_times[decision.Vehicle][decision.Index].push_back(decision.Value);
+            for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+                if ((*l_it).Id != decision.Index) {
+                    node.Forbidden_vehicle_location_times[decision.Vehicle][(*l_it).Id].push_back(decision.Value);
+                }
+            }
+            for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+                if ((*v_it).Id != decision.Vehicle) {
+                    node.Forbidden_vehicle_location_times[(*v_it).Id][decision.Index].push_back(decision.Value);
+                }
+            }
+        }
+    }
+    else if (decision.Family == 2) {
+        if (decision.Direction == 0) {
+            // down branch: task has to be performed earlier than branch time
+            node.Task_start_times_upper_bounds[decision.Vehicle][decision.Index] = decision.Value;
+        }
+        else {
+            // up branch: task has to be performed later or equal than branch time
+            node.Task_start_times_lower_bounds[decision.Vehicle][decision.Index] = decision.Value + 1;
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Start and end times of a route at all locations (0 for locations not visited). */
+void route_location_times(VecI &route_start_times, VecI &route_end_times, vector<VecI> &route, Model &model, int &number_locations) {
+    route_start_times.assign(number_locations, 0);
+    route_end_times.assign(number_locations, 0);
+    for (auto it = route.begin(); it != route.end(); ++it) {
+        route_start_times[(*it)[0]] = (int) round((*it)[2]);
+        route_end_times[(*it)[0]] = (int) round((*it)[2] + model.Possible_task_location_combination_workloads[(*it)[0]][(*it)[1]]);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Check whether a route of vehicle fulfills the task-location combinations and precedences of the scenario and the
+ * branching constraints of the node. */
+bool route_is_feasible_in_node(vector<VecI> &route, VecI &route_start_times, VecI &route_end_times, Vehicle &vehicle, Model &model,
+        vector<Location> &locations, Node &parent_node, int &number_tasks) {
+    // ensure that route fulfills fixed task locations of scenario and of node
+    for (auto x_it = route.begin(); x_it != route.end(); ++x_it) {
+        if (find(model.Scenario_task_location_combinations[(*x_it)[0]].begin(), model.Scenario_task_location_combinations[(*x_it)[0]].end(), (*x_it)[1]) == model.Scenario_task_location_combinations[(*x_it)[0]].end()) {
+            return false;
+        }
+        if (find(parent_node.Forbidden_vehicle_location_combinations[vehicle.Id][(*x_it)[0]].begin(), parent_node.Forbidden_vehicle_location_combinations[vehicle.Id][(*x_it)[0]].end(), (*x_it)[1]) != parent_node.Forbidden_vehicle_location_combinations[vehicle.Id][(*x_it)[0]].end()) {
+            return false;
+        }
+        for (int t = 0; t != number_tasks; ++t) {
+            if (parent_node.Fixed_vehicle_location_tasks[vehicle.Id][(*x_it)[0]][t] != -1 && (int) model.Possible_task_location_combinations[(*x_it)[0]][(*x_it)[1]][t] != parent_node.Fixed_vehicle_location_tasks[vehicle.Id][(*x_it)[0]][t]) {
+                return false;
+            }
+        }
+    }
+    // ensure that route fufills precedences of scenario
+    VecI start_times(number_tasks, 0); // derive start times of operations that include a certain task
+    for (auto x_it = route.begin(); x_it != route.end(); ++x_it) {
+        for (auto t = model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].begin(); t != model.Possible_task_location_combinations_list[(*x_it)[0]][(*x_it)[1]].end(); ++t) {
+            start_times[*t] = (*x_it)[2];
+        }
+    }
+    for (int t1 = 0; t1 != number_tasks; ++t1) {
+        for (int t2 = 0; t2 != number_tasks; ++t2) {
+            if (model.Scenario_all_successors[t1][t2]) {
+                if (start_times[t1] > start_times[t2]) {
+                    return false;
+                }
+            }
+        }
+    }
+    // ensure that route fulfilles enforced and forbidden location times of node
+    for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+        for (auto it = parent_node.Enforced_vehicle_location_times[vehicle.Id][(*l_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[vehicle.Id][(*l_it).Id].end(); ++it) {
+            if (route_start_times[(*l_it).Id] > (*it) || route_end_times[(*l_it).Id] - 1 < (*it)) {
+                return false;
+            }
+        }
+        for (auto it = parent_node.Forbidden_vehicle_location_times[vehicle.Id][(*l_it).Id].begin(); it != parent_node.Forbidden_vehicle_location_times[vehicle.Id][(*l_it).Id].end(); ++it) {
+            if (route_start_times[(*l_it).Id] <= (*it) && route_end_times[(*l_it).Id] - 1 >= (*it)) {
+                return false;
+            }
+        }
+    }
+    // ensure that task time corridors are fulfilled
+    for (int t = 0; t != number_tasks; ++t) {
+        if (!model.Tasks_per_model[t])
+            continue;
+        if (start_times[t] < parent_node.Task_start_times_lower_bounds[vehicle.Id][t] || start_times[t] > parent_node.Task_start_times_upper_bounds[vehicle.Id][t]) {
+            return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
 /* Initialize root route fragment.*/
 void initialize_root_route_fragment(Route_fragment &root, Model &model, Vehicle &vehicle, int &number_locations, vector<vector<VecI>> &zero_half_cuts) {
     root.Id = 0;
@@ -67,6 +316,13 @@ void initialize_root_route_fragment(Route_fragment &root, Model &model, Vehicle
     root.Visits_ZHC = init_vector_visits;
 }
 //------------------------------------------------------------------------------------------------------------//
+/* Check whether a zero-half cut may add more cost to an extension of the dominating route fragment than to the same
+ * extension of the dominated one (the cut cost is due once a route visits two of its location-times): the dominating
+ * fragment has not paid the cut yet and the dominated one has paid it or needs more visits to pay it. */
+bool cut_may_cost_more(int dominating_visits, int dominated_visits) {
+    return dominating_visits <= 1 && (dominated_visits >= 2 || dominating_visits > dominated_visits);
+}
+//------------------------------------------------------------------------------------------------------------//
 /* Check whether new route fragment is dominated by existing route fragment. */
 bool check_dominance1(vector<Route_fragment> &open_fragments, Route_fragment &new_fragment,
                       int &number_tasks, int &number_locations, double &sct_cost, VecD &cut_cost) {
@@ -75,7 +331,7 @@ bool check_dominance1(vector<Route_fragment> &open_fragments, Route_fragment &ne
         if ((*it).Loc == new_fragment.Loc && (*it).End_time <= new_fragment.End_time) {
             double compare_cost((*it).Cost + sct_cost * (new_fragment.End_time - (*it).End_time));
             for (int c = 0; c != cut_cost.size(); ++c) {
-                if ((*it).Visits_ZHC[c] <= 1 && new_fragment.Visits_ZHC[c] >= 2) {
+                if (cut_may_cost_more((*it).Visits_ZHC[c], new_fragment.Visits_ZHC[c])) {
                     compare_cost += cut_cost[c];
                 }
             }
@@ -106,16 +362,17 @@ bool check_dominance1(vector<Route_fragment> &open_fragments, Route_fragment &ne
     return not_dominated;
 }
 //------------------------------------------------------------------------------------------------------------//
-/* Check whether new route fragment dominates existing route fragments. */
+/* Check whether new route fragment dominates existing route fragments. The memory of the removed fragments is
+ * subtracted from label_bytes. */
 void check_dominance2(vector<Route_fragment> &open_fragments, Route_fragment &new_fragment,
-                      int &number_tasks, int &number_locations, double &sct_cost, VecD &cut_cost) {
+                      int &number_tasks, int &number_locations, double &sct_cost, VecD &cut_cost, size_t &label_bytes) {
     auto it = open_fragments.begin();
     while (it != open_fragments.end()) {
         bool dominated(false);
         if ((*it).Loc == new_fragment.Loc && (*it).End_time >= new_fragment.End_time) {
             double compare_cost(new_fragment.Cost + sct_cost * ((*it).End_time - new_fragment.End_time));
             for (int c = 0; c != cut_cost.size(); ++c) {
-                if ((*it).Visits_ZHC[c] >= 2 && new_fragment.Visits_ZHC[c] <= 1) {
+                if (cut_may_cost_more(new_fragment.Visits_ZHC[c], (*it).Visits_ZHC[c])) {
                     compare_cost += cut_cost[c];
                 }
             }
@@ -142,6 +399,7 @@ void check_dominance2(vector<Route_fragment> &open_fragments, Route_fragment &ne
             }
         }
         if (dominated) {
+            label_bytes -= route_fragment_bytes(*it);
             open_fragments.erase(it);
         }
         else {
@@ -150,264 +408,342 @@ void check_dominance2(vector<Route_fragment> &open_fragments, Route_fragment &ne
     }
 }
 //------------------------------------------------------------------------------------------------------------//
-/* Find a new promising route for a vehicle. */
-void find_new_routes(vector<vector<VecI>> &new_routes, VecD &new_routes_cost, int &v_id, Vehicle &vehicle, Model &model, vector<Location> &locations,
-                     vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times, int &number_locations,
-                     int &number_tasks, Node &parent_node, int &ub, int &horizon, double &time_sp_identify_extension, double &time_sp_perform_extension,
-                     double &time_sp_dominance_check_1, double &time_sp_dominance_check_2, double &time_add_fragment) {
-    // initialize root route fragment
-    Route_fragment root;
-    initialize_root_route_fragment(root, model, vehicle, number_locations, zero_half_cuts);
-    // create list of open route fragments
-    vector<Route_fragment> open_fragments;
-    open_fragments.push_back(root);
-    // start route generation
-    VecB all_tasks_performed(number_tasks, false);
-    int id_count(1);
-    while (!open_fragments.empty()) {
-        clock_t start_sp_identify_extension = clock();
-        // select parent route to be developed further: route that currently ends at location furthest to the left
-        Route_fragment parent = open_fragments[0];
-        // delete parent route fragment
-        open_fragments.erase(open_fragments.begin());
-        // identify candidates for extending old route fragment
-        vector<Candidate> candidates;
-        int cand_id(0);
-        for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-            if (!parent.Accessible_locations[(*l_it).Id]) // location needs to be still accessible
-                continue;
-            int earliest_start(parent.End_time + transportation_times[parent.Loc][(*l_it).Id]);
-            // feasibility check: new route needs to finish before end of horizon
-            if (earliest_start + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - vehicle.Arrival_time >= ub)
+/* Identify candidates for extending parent route fragment: feasible (location, task_combination, start time) tuples
+ * whose extended route can still reach a reduced cost below rc_limit (0 in pricing) and finish below ub. */
+void identify_extension_candidates(vector<Candidate> &candidates, Route_fragment &parent, int &v_id, Vehicle &vehicle, Model &model, vector<Location> &locations,
+                                   vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times,
+                                   int &number_locations, int &number_tasks, Node &parent_node, int &ub, double &rc_limit, bool &enumerate) {
+    int cand_id(0);
+    for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+        if (!parent.Accessible_locations[(*l_it).Id]) // location needs to be still accessible
+            continue;
+        int earliest_start(parent.End_time + transportation_times[parent.Loc][(*l_it).Id]);
+        // feasibility check: new route needs to finish before end of horizon
+        if (earliest_start + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - vehicle.Arrival_time >= ub)
+            continue;
+        // feasibility check: new route needs to have reduced cost below rc_limit
+        if (parent.Cost + vehicle.Sct_cost * (transportation_times[parent.Loc][(*l_it).Id] + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1]) > vehicle.Max_cost + rc_limit - PRECISION)
+            continue;
+        for (size_t c_index = 0; c_index != vehicle.Available_task_location_combinations[(*l_it).Id].size(); ++c_index) {
+            int c(vehicle.Available_task_location_combinations[(*l_it).Id][c_index]);
+            bool feasible(true);
+            // check if all tasks are still missing
+            for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
+                if (!parent.Missing_tasks[*t_it]) {
+                    feasible = false;
+                    break;
+                }
+            }
+            if (!feasible)
                 continue;
-            // feasibility check: new route needs to have negative reduced cost
-            if (parent.Cost + vehicle.Sct_cost * (transportation_times[parent.Loc][(*l_it).Id] + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1]) > vehicle.Max_cost - PRECISION)
+            // ensure that all precedence relations are met
+            for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
+                for (int tp = 0; tp != number_tasks; ++tp) {
+                    if (model.Scenario_all_predecessors[*t_it][tp]) {
+                        if (parent.Missing_tasks[tp] && !model.Possible_task_location_combinations[(*l_it).Id][c][tp]) {
+                            feasible = false;
+                            break;
+                        }
+                    }
+                    if (!feasible)
+                        break;
+                }
+            }
+            if (!feasible)
                 continue;
-            for (size_t c_index = 0; c_index != vehicle.Available_task_location_combinations[(*l_it).Id].size(); ++c_index) {
-                int c(vehicle.Available_task_location_combinations[(*l_it).Id][c_index]);
-                bool feasible(true);
-                // check if all tasks are still missing
-                for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
-                    if (!parent.Missing_tasks[*t_it]) {
+            // feasibility check: transportation arc cannot exist if enforced location at same time
+            for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) {
+                for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].end(); ++it) {
+                    if (*it >= parent.End_time && *it < earliest_start) {
                         feasible = false;
                         break;
                     }
                 }
                 if (!feasible)
-                    continue;
-                // ensure that all precedence relations are met
-                for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
-                    for (int tp = 0; tp != number_tasks; ++tp) {
-                        if (model.Scenario_all_predecessors[*t_it][tp]) {
-                            if (parent.Missing_tasks[tp] && !model.Possible_task_location_combinations[(*l_it).Id][c][tp]) {
-                                feasible = false;
-                                break;
-                            }
-                        }
-                        if (!feasible)
-                            break;
-                    }
-                }
-                if (!feasible)
-                    continue;
-                // feasibility check: transportation arc cannot exist if enforced location at same time
-                for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) {
+                    break;
+            }
+            if (!feasible)
+                continue;
+            if ((*l_it).Id == number_locations - 1) {
+                for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) { //ensure that there are no enforced location times after route end
                     for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].end(); ++it) {
-                        if (*it >= parent.End_time && *it < earliest_start) {
+                        if (*it >= earliest_start) {
                             feasible = false;
                             break;
                         }
                     }
-                    if (!feasible)
-                        break;
                 }
                 if (!feasible)
                     continue;
-                if ((*l_it).Id == number_locations - 1) {
-                    for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) { //ensure that there are no enforced location times after route end
+                Candidate extension_candidate;
+                extension_candidate.Id = cand_id;
+                extension_candidate.Extension = {(*l_it).Id, c, earliest_start};
+                extension_candidate.Add_cost = vehicle.Sct_cost * (earliest_start - parent.End_time);
+                extension_candidate.End_time = earliest_start;
+                extension_candidate.Level_index = (*l_it).Level_index;
+                candidates.push_back(extension_candidate);
+                ++cand_id;
+            }
+            else {
+                // derive task sequence
+                int waiting(0);
+                double best_cum_block_cost(vehicle.Max_cost);
+                while (1) {
+                    int start_time(earliest_start + waiting);
+                    // feasibility check: new route needs to finish before end of horizon
+                    if (start_time + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - vehicle.Arrival_time >= ub)
+                        break;
+                    // feasibility check: new route needs to have reduced cost below rc_limit
+                    if (parent.Cost + vehicle.Sct_cost * (start_time + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - parent.End_time) > vehicle.Max_cost + rc_limit - PRECISION)
+                        break;
+                    bool feasible_enforced(true);
+                    // feasibility check: arc cannot exist if enforced other location at same time
+                    for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) {
+                        if ((*l2_it).Id == (*l_it).Id)
+                            continue;
                         for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].end(); ++it) {
-                            if (*it >= earliest_start) {
-                                feasible = false;
+                            if ((*it) >= earliest_start && (*it) < start_time + model.Possible_task_location_combination_workloads[(*l_it).Id][c]) {
+                                feasible_enforced = false;
                                 break;
                             }
                         }
-                    }
-                    if (!feasible)
-                        continue;
-                    Candidate extension_candidate;
-                    extension_candidate.Id = cand_id;
-                    extension_candidate.Extension = {(*l_it).Id, c, earliest_start};
-                    extension_candidate.Add_cost = vehicle.Sct_cost * (earliest_start - parent.End_time);
-                    extension_candidate.End_time = earliest_start;
-                    extension_candidate.Level_index = (*l_it).Level_index;
-                    candidates.push_back(extension_candidate);
-                    ++cand_id;
-                }
-                else {
-                    // derive task sequence
-                    int waiting(0);
-                    double best_cum_block_cost(vehicle.Max_cost);
-                    while (1) {
-                        int start_time(earliest_start + waiting);
-                        // feasibility check: new route needs to finish before end of horizon
-                        if (start_time + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - vehicle.Arrival_time >= ub)
+                        if (!feasible_enforced)
                             break;
-                        // feasibility check: new route needs to have negative reduced cost
-                        if (parent.Cost + vehicle.Sct_cost * (start_time + parent.Missing_task_time + transportation_times[(*l_it).Id][number_locations - 1] - parent.End_time) > vehicle.Max_cost - PRECISION)
+                    }
+                    if (!feasible_enforced)
+                        break;
+                    // check task start time feasibility with branching
+                    bool feasible_start_times(true);
+                    for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
+                        if (parent_node.Task_start_times_lower_bounds[v_id][*t_it] > start_time || parent_node.Task_start_times_upper_bounds[v_id][(*t_it)] < start_time) {
+                            feasible_start_times = false;
                             break;
-                        bool feasible_enforced(true);
-                        // feasibility check: arc cannot exist if enforced other location at same time
-                        for (auto l2_it = locations.begin(); l2_it != locations.end(); ++l2_it) {
-                            if ((*l2_it).Id == (*l_it).Id)
-                                continue;
-                            for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l2_it).Id].end(); ++it) {
-                                if ((*it) >= earliest_start && (*it) < start_time + model.Possible_task_location_combination_workloads[(*l_it).Id][c]) {
-                                    feasible_enforced = false;
-                                    break;
-                                }
-                            }
-                            if (!feasible_enforced)
-                                break;
                         }
-                        if (!feasible_enforced)
-                            break;
-                        // check task start time feasibility with branching
-                        bool feasible_start_times(true);
-                        for (auto t_it = model.Possible_task_location_combinations_list[(*l_it).Id][c].begin(); t_it != model.Possible_task_location_combinations_list[(*l_it).Id][c].end(); ++t_it) {
-                            if (parent_node.Task_start_times_lower_bounds[v_id][*t_it] > start_time || parent_node.Task_start_times_upper_bounds[v_id][(*t_it)] < start_time) {
-                                feasible_start_times = false;
+                    }
+                    if (feasible_start_times) {
+                        int end_time(start_time + model.Possible_task_location_combination_workloads[(*l_it).Id][c]);
+                        bool feasible_location_times(true);
+                        for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l_it).Id].end(); ++it) {
+                            if (start_time > *it || end_time - 1 < *it) {
+                                feasible_location_times = false;
                                 break;
                             }
                         }
-                        if (feasible_start_times) {
-                            int end_time(start_time + model.Possible_task_location_combination_workloads[(*l_it).Id][c]);
-                            bool feasible_location_times(true);
-                            for (auto it = parent_node.Enforced_vehicle_location_times[v_id][(*l_it).Id].begin(); it != parent_node.Enforced_vehicle_location_times[v_id][(*l_it).Id].end(); ++it) {
-                                if (start_time > *it || end_time - 1 < *it) {
-                                    feasible_location_times = false;
-                                    break;
-                                }
+                        for (auto it = parent_node.Forbidden_vehicle_location_times[v_id][(*l_it).Id].begin(); it != parent_node.Forbidden_vehicle_location_times[v_id][(*l_it).Id].end(); ++it) {
+                            if (start_time <= *it && end_time > *it) {
+                                feasible_location_times = false;
+                                break;
                             }
-                            for (auto it = parent_node.Forbidden_vehicle_location_times[v_id][(*l_it).Id].begin(); it != parent_node.Forbidden_vehicle_location_times[v_id][(*l_it).Id].end(); ++it) {
-                                if (start_time <= *it && end_time > *it) {
-                                    feasible_location_times = false;
-                                    break;
+                        }
+                        if (feasible_location_times) {
+                            double cum_block_cost(0.0);
+                            for (int z = start_time; z != end_time; ++z) {
+                                if (block_cost[(*l_it).Id][z] > 0) {
+                                    cum_block_cost += block_cost[(*l_it).Id][z];
                                 }
                             }
-                            if (feasible_location_times) {
-                                double cum_block_cost(0.0);
-                                for (int z = start_time; z != end_time; ++z) {
-                                    if (block_cost[(*l_it).Id][z] > 0) {
-                                        cum_block_cost += block_cost[(*l_it).Id][z];
+                            double cum_cut_cost(0.0);
+                            VecI visit_extend(zero_half_cuts.size(), 0);
+                            for (int zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
+                                for (auto c = zero_half_cuts[zhc].begin(); c != zero_half_cuts[zhc].end(); ++c) {
+                                    if ((*c)[0] == (*l_it).Id && start_time <= (*c)[1] && end_time > (*c)[1]) {
+                                        ++visit_extend[zhc];
                                     }
                                 }
-                                double cum_cut_cost(0.0);
-                                VecI visit_extend(zero_half_cuts.size(), 0);
-                                for (int zhc = 0; zhc != zero_half_cuts.size(); ++zhc) {
-                                    for (auto c = zero_half_cuts[zhc].begin(); c != zero_half_cuts[zhc].end(); ++c) {
-                                        if ((*c)[0] == (*l_it).Id && start_time <= (*c)[1] && end_time > (*c)[1]) {
-                                            ++visit_extend[zhc];
-                                        }
-                                    }
-                                    if (parent.Visits_ZHC[zhc] == 1 && visit_extend[zhc] >= 1) {
-                                        cum_cut_cost += cut_cost[zhc];
-                                    }
-                                    else if (parent.Visits_ZHC[zhc] == 0 && visit_extend[zhc] >= 2) {
-                                        cum_cut_cost += cut_cost[zhc];
-                                    }
+                                if (parent.Visits_ZHC[zhc] == 1 && visit_extend[zhc] >= 1) {
+                                    cum_cut_cost += cut_cost[zhc];
                                 }
-                                double additional_cost(vehicle.Sct_cost * (end_time - parent.End_time) + cum_block_cost + cum_cut_cost);
-                                // feasibility check: new route needs to have negative reduced cost
-                                if (parent.Cost + additional_cost + vehicle.Sct_cost * (parent.Missing_task_time - model.Possible_task_location_combination_workloads[(*l_it).Id][c] + transportation_times[(*l_it).Id][number_locations - 1]) < vehicle.Max_cost - PRECISION) {
-                                        Candidate extension_candidate;
-                                        extension_candidate.Id = cand_id;
-                                        extension_candidate.Extension = {(*l_it).Id, c, start_time};
-                                        extension_candidate.Add_cost = additional_cost;
-                                        extension_candidate.End_time = end_time;
-                                        extension_candidate.Level_index = (*l_it).Level_index;
-                                        extension_candidate.Visit_ZHC_Change = visit_extend;
-                                        candidates.push_back(extension_candidate);
-                                        ++cand_id;
+                                else if (parent.Visits_ZHC[zhc] == 0 && visit_extend[zhc] >= 2) {
+                                    cum_cut_cost += cut_cost[zhc];
                                 }
-                                if (cum_block_cost == 0 && cum_cut_cost == 0)
-                                    break;
                             }
+                            double additional_cost(vehicle.Sct_cost * (end_time - parent.End_time) + cum_block_cost + cum_cut_cost);
+                            // feasibility check: new route needs to have reduced cost below rc_limit
+                            if (parent.Cost + additional_cost + vehicle.Sct_cost * (parent.Missing_task_time - model.Possible_task_location_combination_workloads[(*l_it).Id][c] + transportation_times[(*l_it).Id][number_locations - 1]) < vehicle.Max_cost + rc_limit - PRECISION) {
+                                    Candidate extension_candidate;
+                                    extension_candidate.Id = cand_id;
+                                    extension_candidate.Extension = {(*l_it).Id, c, start_time};
+                                    extension_candidate.Add_cost = additional_cost;
+                                    extension_candidate.End_time = end_time;
+                                    extension_candidate.Level_index = (*l_it).Level_index;
+                                    extension_candidate.Visit_ZHC_Change = visit_extend;
+                                    candidates.push_back(extension_candidate);
+                                    ++cand_id;
+                            }
+                            // waiting longer only increases the cost (all later routes are needed for enumeration)
+                            if (!enumerate && cum_block_cost == 0 && cum_cut_cost == 0)
+                                break;
                         }
-                        ++waiting;
                     }
+                    ++waiting;
                 }
             }
         }
-        time_sp_identify_extension += double(clock() - start_sp_identify_extension) / CLOCKS_PER_SEC;
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Extend parent route fragment by candidate. Returns true if the new route fragment ends at the end location. */
+bool extend_route_fragment(Route_fragment &new_fragment, Route_fragment &parent, Candidate &cand, Model &model, vector<Location> &locations,
+                           int &number_locations, vector<vector<VecI>> &zero_half_cuts) {
+    new_fragment.Route = parent.Route;
+    new_fragment.Route.push_back(cand.Extension);
+    new_fragment.Loc = cand.Extension[0];
+    new_fragment.End_time = cand.End_time;
+    new_fragment.Level_index = cand.Level_index;
+    new_fragment.Cost = parent.Cost + cand.Add_cost;
+    new_fragment.Missing_task_time = parent.Missing_task_time - model.Possible_task_location_combination_workloads[cand.Extension[0]][cand.Extension[1]];
+    new_fragment.Missing_tasks = parent.Missing_tasks;
+    for (auto t_it = model.Possible_task_location_combinations_list[cand.Extension[0]][cand.Extension[1]].begin(); t_it != model.Possible_task_location_combinations_list[cand.Extension[0]][cand.Extension[1]].end(); ++t_it) {
+        new_fragment.Missing_tasks[*t_it] = false;
+    }
+    if (new_fragment.Loc == number_locations - 1)
+        return true;
+    new_fragment.Accessible_locations = parent.Accessible_locations;
+    new_fragment.Accessible_locations[new_fragment.Loc] = false;
+    for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
+        if (!new_fragment.Accessible_locations[(*l_it).Id])
+            continue;
+        if ((*l_it).Level_index < new_fragment.Level_index) {
+            new_fragment.Accessible_locations[(*l_it).Id] = false;
+            continue;
+        }
+    }
+    new_fragment.Visits_ZHC = parent.Visits_ZHC;
+    for (int c = 0; c != zero_half_cuts.size(); ++c) {
+        new_fragment.Visits_ZHC[c] += cand.Visit_ZHC_Change[c];
+    }
+    return false;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Find a new promising route for a vehicle. The search ends early if stop is set.
+ * With enumerate, all routes with reduced cost below rc_limit are found: dominance is not applied and the search ends
+ * (incomplete) once more than route_limit routes are found. */
+void find_new_routes(vector<vector<VecI>> &new_routes, VecD &new_routes_cost, int &v_id, Vehicle &vehicle, Model &model, vector<Location> &locations,
+                     vector<VecD> &block_cost, VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<VecI> &transportation_times, int &number_locations,
+                     int &number_tasks, Node &parent_node, int &ub, int &horizon, double &rc_limit, bool &enumerate, int &route_limit, atomic<bool> &stop, Pricing_statistics &statistics) {
+    // initialize root route fragment
+    Route_fragment root;
+    initialize_root_route_fragment(root, model, vehicle, number_locations, zero_half_cuts);
+    // create list of open route fragments
+    vector<Route_fragment> open_fragments;
+    open_fragments.push_back(root);
+    size_t label_bytes(route_fragment_bytes(open_fragments.back())); // memory of open route fragments
+    statistics.Peak_label_bytes = max(statistics.Peak_label_bytes, label_bytes);
+    // start route generation
+    VecB all_tasks_performed(number_tasks, false);
+    int id_count(1);
+    while (!open_fragments.empty()) {
+        if (stop || (enumerate && (int) new_routes.size() > route_limit))
+            return;
+        PROFILE_BEGIN(identify_extension_timer, "Sp_identify_extension");
+        // select parent route to be developed further: route that currently ends at location furthest to the left
+        Route_fragment parent = open_fragments[0];
+        // delete parent route fragment
+        label_bytes -= route_fragment_bytes(open_fragments[0]);
+        open_fragments.erase(open_fragments.begin());
+        // identify candidates for extending old route fragment
+        vector<Candidate> candidates;
+        identify_extension_candidates(candidates, parent, v_id, vehicle, model, locations, block_cost, cut_cost, zero_half_cuts, transportation_times,
+                                      number_locations, number_tasks, parent_node, ub, rc_limit, enumerate);
+        PROFILE_END(identify_extension_timer);
         // extend route fragment by candidates
         for (size_t c_index = 0; c_index != candidates.size(); ++c_index) {
-            clock_t start_sp_perform_extension = clock();
+            PROFILE_BEGIN(perform_extension_timer, "Sp_perform_extension");
             Candidate cand(candidates[c_index]);
             Route_fragment new_fragment;
-            new_fragment.Route = parent.Route;
-            new_fragment.Route.push_back(cand.Extension);
-            new_fragment.Loc = cand.Extension[0];
-            new_fragment.End_time = cand.End_time;
-            new_fragment.Level_index = cand.Level_index;
-            new_fragment.Cost = parent.Cost + cand.Add_cost;
-            new_fragment.Missing_task_time = parent.Missing_task_time - model.Possible_task_location_combination_workloads[cand.Extension[0]][cand.Extension[1]];
-            new_fragment.Missing_tasks = parent.Missing_tasks;
-            for (auto t_it = model.Possible_task_location_combinations_list[cand.Extension[0]][cand.Extension[1]].begin(); t_it != model.Possible_task_location_combinations_list[cand.Extension[0]][cand.Extension[1]].end(); ++t_it) {
-                new_fragment.Missing_tasks[*t_it] = false;
-            }
-            if (new_fragment.Loc == number_locations - 1) {
+            ++statistics.Labels_created;
+            if (extend_route_fragment(new_fragment, parent, cand, model, locations, number_locations, zero_half_cuts)) {
                 if (new_fragment.Missing_tasks == all_tasks_performed) { // this condition can be removed
                     new_routes.push_back(new_fragment.Route);
                     new_routes_cost.push_back(new_fragment.Cost);
                 }
-                time_sp_perform_extension += double(clock() - start_sp_perform_extension) / CLOCKS_PER_SEC;
+                PROFILE_END(perform_extension_timer);
                 continue;
             }
-            new_fragment.Accessible_locations = parent.Accessible_locations;
-            new_fragment.Accessible_locations[new_fragment.Loc] = false;
-            for (auto l_it = locations.begin(); l_it != locations.end(); ++l_it) {
-                if (!new_fragment.Accessible_locations[(*l_it).Id])
-                    continue;
-                if ((*l_it).Level_index < new_fragment.Level_index) {
-                    new_fragment.Accessible_locations[(*l_it).Id] = false;
-                    continue;
-                }
-            }
-            new_fragment.Visits_ZHC = parent.Visits_ZHC;
-            for (int c = 0; c != zero_half_cuts.size(); ++c) {
-                new_fragment.Visits_ZHC[c] += cand.Visit_ZHC_Change[c];
-            }
-            time_sp_perform_extension += double(clock() - start_sp_perform_extension) / CLOCKS_PER_SEC;
+            PROFILE_END(perform_extension_timer);
             // dominance check 1: check if new route fragment is dominated by existing route fragment
-            clock_t start_sp_dominance_check_1 = clock();
-            bool not_dominated = check_dominance1(open_fragments, new_fragment, number_tasks, number_locations, vehicle.Sct_cost, cut_cost);
-            time_sp_dominance_check_1 += double(clock() - start_sp_dominance_check_1) / CLOCKS_PER_SEC;
+            PROFILE_BEGIN(dominance_check_1_timer, "Sp_dominance_check_1");
+            bool not_dominated(enumerate || check_dominance1(open_fragments, new_fragment, number_tasks, number_locations, vehicle.Sct_cost, cut_cost));
+            PROFILE_END(dominance_check_1_timer);
+            if (!not_dominated)
+                ++statistics.Labels_dominated;
             if (not_dominated) {
-                clock_t start_sp_dominance_check_2 = clock();
+                PROFILE_BEGIN(dominance_check_2_timer, "Sp_dominance_check_2");
                 // dominance check 2: check if new route fragment is dominating existing route fragment
-                check_dominance2(open_fragments, new_fragment, number_tasks, number_locations, vehicle.Sct_cost, cut_cost);
-                time_sp_dominance_check_2 += double(clock() - start_sp_dominance_check_2) / CLOCKS_PER_SEC;
-                clock_t start_add_fragment = clock();
+                if (!enumerate) {
+                    size_t open_before(open_fragments.size());
+                    check_dominance2(open_fragments, new_fragment, number_tasks, number_locations, vehicle.Sct_cost, cut_cost, label_bytes);
+                    statistics.Labels_dominated += (long long) (open_before - open_fragments.size());
+                }
+                PROFILE_END(dominance_check_2_timer);
+                PROFILE_BEGIN(add_fragment_timer, "Add_fragment");
                 new_fragment.Id = id_count;
                 ++id_count;
-                bool new_fragment_inserted(false);
+                auto inserted(open_fragments.end());
                 for (auto it = open_fragments.begin(); it != open_fragments.end(); ++it) {
                     if ((*it).Level_index > new_fragment.Level_index) {
-                        open_fragments.insert(it, new_fragment);
-                        new_fragment_inserted = true;
+                        inserted = open_fragments.insert(it, new_fragment);
                         break;
                     }
                     if ((*it).Level_index == new_fragment.Level_index && (*it).Cost > new_fragment.Cost) {
-                        open_fragments.insert(it, new_fragment);
-                        new_fragment_inserted = true;
+                        inserted = open_fragments.insert(it, new_fragment);
                         break;
                     }
                 }
-                if (!new_fragment_inserted)
+                if (inserted == open_fragments.end()) {
                     open_fragments.push_back(new_fragment);
-                time_add_fragment += double(clock() - start_add_fragment) / CLOCKS_PER_SEC;
+                    inserted = open_fragments.end() - 1;
+                }
+                label_bytes += route_fragment_bytes(*inserted);
+                statistics.Peak_label_bytes = max(statistics.Peak_label_bytes, label_bytes);
+                PROFILE_END(add_fragment_timer);
             }
         }
     }
 }
 //------------------------------------------------------------------------------------------------------------//
+/* Check if route is a feasible route of vehicle in the instance: it starts at the start location at the arrival time,
+ * ends at the end location, visits locations at most once with non-decreasing level, respects transportation times
+ * and the horizon, and performs each task of the model exactly once after all of its predecessors. */
+bool validate_route(vector<VecI> &route, Vehicle &vehicle, Model &model, vector<Location> &locations, vector<VecI> &transportation_times,
+        int &number_locations, int &number_tasks, int &horizon) {
+    if (route.size() < 2 || route[0] != VecI({0, 0, vehicle.Arrival_time}) || route.back().size() != 3 || route.back()[0] != number_locations - 1)
+        return false;
+    VecB visited(number_locations, false);
+    VecI performed_at(number_tasks, -1);
+    int level(0);
+    int end_time(vehicle.Arrival_time);
+    for (size_t i = 0; i != route.size(); ++i) {
+        if (route[i].size() != 3)
+            return false;
+        int l(route[i][0]), c(route[i][1]), z(route[i][2]);
+        if (l < 0 || l >= number_locations || visited[l] || c < 0 || c >= (int) model.Possible_task_location_combinations_list[l].size())
+            return false;
+        if (locations[l].Level_index < level)
+            return false;
+        if (i > 0 && z < end_time + transportation_times[route[i - 1][0]][l])
+            return false;
+        visited[l] = true;
+        level = locations[l].Level_index;
+        end_time = z + model.Possible_task_location_combination_workloads[l][c];
+        if (end_time > horizon)
+            return false;
+        for (auto t_it = model.Possible_task_location_combinations_list[l][c].begin(); t_it != model.Possible_task_location_combinations_list[l][c].end(); ++t_it) {
+            if ((*t_it) < 0 || (*t_it) >= number_tasks || performed_at[(*t_it)] != -1)
+                return false;
+            performed_at[(*t_it)] = (int) i;
+        }
+    }
+    for (int t = 1; t != number_tasks; ++t) {
+        if (model.Tasks_per_model[t] != (performed_at[t] != -1))
+            return false;
+        if (performed_at[t] == -1)
+            continue;
+        for (int p = 1; p != number_tasks; ++p) {
+            if (model.Tasks_per_model[p] && model.All_predecessors[t][p] && performed_at[p] > performed_at[t])
+                return false;
+        }
+    }
+    return true;
+}
+//------------------------------------------------------------------------------------------------------------//
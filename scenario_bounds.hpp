@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Bounds shared between the scenarios of an instance (0: NF, 1: OF, 2: RF, 3: FF).
+ * A solution of a scenario is feasible for its more flexible scenarios (NF for OF, RF, and FF; OF and RF for FF), so its sct
+ * is an upper bound for them. Conversely, a lower bound of a scenario is valid for its less flexible scenarios.
+ * Solutions are shared as route details since each scenario may solve on its own copy of the column pool. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Scenario_bounds {
+    mutex Mutex; // protects all bounds
+    VecI Ub; // best known sct per scenario
+    vector<vector<vector<VecI>>> Ub_routes; // route details of the best known solution per scenario and vehicle
+    VecI Lb; // proven lower bound of sct per scenario
+    vector<VecI> More_flexible; // scenarios whose solution spaces contain the solutions of the scenario
+};
+//------------------------------------------------------------------------------------------------------------//
+void initialize_scenario_bounds(Scenario_bounds &bounds, int &ub, VecI &sol, vector<Vehicle> &vehicles) {
+    vector<vector<VecI>> routes;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        routes.push_back((*v_it).Route_details[sol[(*v_it).Id]]);
+    }
+    bounds.Ub.assign(4, ub);
+    bounds.Ub_routes.assign(4, routes);
+    bounds.Lb.assign(4, 0);
+    bounds.More_flexible = {{1, 2, 3}, {3}, {3}, {}};
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Share solution of scenario as upper bound for the scenario and its more flexible scenarios. */
+void publish_upper_bound(Scenario_bounds &bounds, int &scenario, int &ub, VecI &best_sol, vector<Vehicle> &vehicles) {
+    lock_guard<mutex> lock(bounds.Mutex);
+    VecI receivers(bounds.More_flexible[scenario]);
+    receivers.push_back(scenario);
+    for (auto s_it = receivers.begin(); s_it != receivers.end(); ++s_it) {
+        if (ub >= bounds.Ub[(*s_it)])
+            continue;
+        bounds.Ub[(*s_it)] = ub;
+        for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+            bounds.Ub_routes[(*s_it)][(*v_it).Id] = (*v_it).Route_details[best_sol[(*v_it).Id]];
+        }
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Share lower bound of scenario with the scenario and its less flexible scenarios. */
+void publish_lower_bound(Scenario_bounds &bounds, int &scenario, int &lb) {
+    lock_guard<mutex> lock(bounds.Mutex);
+    for (int s = 0; s != (int) bounds.Lb.size(); ++s) {
+        if (s == scenario || find(bounds.More_flexible[s].begin(), bounds.More_flexible[s].end(), scenario) != bounds.More_flexible[s].end())
+            bounds.Lb[s] = max(bounds.Lb[s], lb);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Update ub, best solution, horizon, and lb of scenario with the shared bounds. Routes of a shared solution that are
+ * not in the column pool are added to it. */
+void fetch_scenario_bounds(Scenario_bounds &bounds, int &scenario, int &ub, VecI &best_sol, int &horizon, int &lb, vector<Model> &models,
+        vector<Vehicle> &vehicles, vector<vector<vector<VecI>>> &blockings, int &number_locations) {
+    lock_guard<mutex> lock(bounds.Mutex);
+    lb = max(lb, bounds.Lb[scenario]);
+    if (bounds.Ub[scenario] >= ub)
+        return;
+    ub = bounds.Ub[scenario];
+    horizon = vehicles.back().Arrival_time + ub;
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        vector<VecI> &route(bounds.Ub_routes[scenario][(*v_it).Id]);
+        auto it(find((*v_it).Route_details.begin(), (*v_it).Route_details.end(), route));
+        if (it != (*v_it).Route_details.end())
+            best_sol[(*v_it).Id] = (int) distance((*v_it).Route_details.begin(), it);
+        else
+            best_sol[(*v_it).Id] = add_route_to_pool((*v_it), route, models[(*v_it).Type], blockings, number_locations);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Settings of the branch-and-price threshold search (see the settings in main.cpp). The settings are fixed during a
+ * search: the tree search (Tree_search) owns a copy that all workers read without locking. Strong branching and
+ * diving solve their nodes with node_heuristic_settings. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Search_settings {
+    double Time_limit = 3600.0; // time limit of the scenario
+    bool Master_activity_end = true; // master problem: blocking constraints only at end of activities
+    VecS Branching{"ASSIGN", "TIME", "USAGE"}; // sequence of branching choices
+    int Max_routes_per_vehicle = 50; // maximum number of added routes per vehicle and column generation iteration
+    int Max_cg_iterations = 0; // maximum number of column generation iterations per node (0: no limit)
+    string Node_selection = "DEPTH"; // DEPTH, BEST_BOUND, or HYBRID
+    int Best_bound_frequency = 10; // HYBRID: every n-th node is the open node with the lowest lower bound
+    int Threads = 1; // worker threads of the tree search
+    string Branching_rule = "ORDER"; // ORDER, PSEUDOCOST, or STRONG
+    int Strong_branching_candidates = 5; // STRONG: number of evaluated candidates
+    int Strong_branching_iterations = 10; // STRONG: column generation iterations per child node
+    bool Reduced_cost_fixing = false; // remove task-location combinations by reduced cost
+    int Mip_search_frequency = 0; // restricted master MIP every n-th node (0: never)
+    double Mip_search_time_limit = 10.0; // time limit of restricted master MIP
+    double Route_mip_time_limit = 0.0; // time limit of time-continuous MIP at nodes with integral routes (0: never)
+    double Enumeration_gap = 0.0; // solve nodes with gap <= n by route enumeration (0: never)
+    int Enumeration_routes = 20000; // maximum number of enumerated routes per vehicle
+    double Enumeration_time_limit = 30.0; // time limit of MIP over enumerated routes
+    int Diving_frequency = 0; // diving heuristic every n-th node (0: never)
+    int Diving_iterations = 5; // column generation iterations per diving step
+    int Diving_backtracks = 3; // backtracks per dive
+    int Pricing_seed = 0; // seed of tie breaking in the pricing order
+    int Pricing_vehicles = 5; // initial number of vehicles with new routes after which a pricing round stops
+    bool Async_pricing = false; // price vehicles not reached by a round during the master re-optimization
+    string Column_selection = "MOST_NEGATIVE"; // MOST_NEGATIVE, DIVERSE, or MIXED
+    bool Column_transfer = false; // offer time-shifted copies of new routes to vehicles of the same model
+    string Pricing_engine = "LABELING"; // LABELING, PULSE, or RACE
+    int Pulse_labels = 50; // pulse search: route fragments kept per location
+    bool Use_root_bound = true; // threshold search starting at root node lower bound (else single threshold at ub)
+    string Threshold_search = "INCREMENT"; // INCREMENT, GALLOP, or BISECTION
+    double Checkpoint_interval = 0.0; // write a checkpoint every n seconds and at the time limit (0: never)
+    string Checkpoint_file; // checkpoint of the search
+    bool Resume = false; // resume the search from its checkpoint
+};
+//------------------------------------------------------------------------------------------------------------//
+/* Settings of nodes solved by strong branching and diving: at most max_cg_iterations column generation iterations and
+ * no reduced cost fixing, route MIP, or route enumeration. */
+Search_settings node_heuristic_settings(Search_settings &settings, int &max_cg_iterations) {
+    Search_settings heuristic_settings(settings);
+    heuristic_settings.Max_cg_iterations = max_cg_iterations;
+    heuristic_settings.Reduced_cost_fixing = false;
+    heuristic_settings.Route_mip_time_limit = 0.0;
+    heuristic_settings.Enumeration_gap = 0.0;
+    return heuristic_settings;
+}
+//------------------------------------------------------------------------------------------------------------//
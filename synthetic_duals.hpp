@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Synthetic duals of the master problem for pricing without Gurobi (benchmark and differential harness).
+ * The sct duals sum up to 1 over the vehicles, a share of the location-time blocks of the inner locations gets a
+ * positive cost, and the route selection dual of a vehicle exceeds the cost of a route with minimum sct.
+ * Synthetic zero-half cuts consist of random location-times of the inner locations and cost a route that visits at
+ * least two of them. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+/* block_density: share of blocks with positive cost, block_scale: maximum block cost relative to the sct dual of a
+ * vehicle, max_cost_slack: route selection dual is (1 + slack) times the cost of a route with minimum sct. */
+void generate_synthetic_duals(vector<VecD> &block_cost, vector<Model> &models, vector<Vehicle> &vehicles, int &number_locations, int &horizon, int &seed,
+        double &block_density, double &block_scale, double &max_cost_slack) {
+    mt19937 generator((unsigned) seed);
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    double sct_cost(1.0 / vehicles.size());
+    block_cost.assign(number_locations, VecD(horizon, 0.0));
+    for (int l = 1; l < number_locations - 1; ++l) {
+        for (int z = 0; z != horizon; ++z) {
+            if (uniform(generator) < block_density)
+                block_cost[l][z] = uniform(generator) * block_scale * sct_cost;
+        }
+    }
+    for (auto v_it = vehicles.begin(); v_it != vehicles.end(); ++v_it) {
+        (*v_it).Sct_cost = sct_cost;
+        (*v_it).Max_cost = (1 + max_cost_slack) * models[(*v_it).Type].Min_sct * sct_cost;
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
+/* number_cuts: number of zero-half cuts with cut_size location-times each, cut_scale: maximum cut cost relative to the
+ * sct dual of a vehicle (see generate_synthetic_duals). */
+void generate_synthetic_cuts(VecD &cut_cost, vector<vector<VecI>> &zero_half_cuts, vector<Vehicle> &vehicles, int &number_locations, int &horizon,
+        int &seed, int &number_cuts, int &cut_size, double &cut_scale) {
+    mt19937 generator((unsigned) seed);
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    uniform_int_distribution<int> location(1, max(1, number_locations - 2));
+    uniform_int_distribution<int> time(vehicles.front().Arrival_time, max(vehicles.front().Arrival_time, horizon - 1));
+    double sct_cost(1.0 / vehicles.size());
+    cut_cost.clear();
+    zero_half_cuts.clear();
+    for (int c = 0; c != number_cuts; ++c) {
+        vector<VecI> cut;
+        for (int i = 0; i != cut_size; ++i) {
+            cut.push_back({location(generator), time(generator)});
+        }
+        zero_half_cuts.push_back(cut);
+        cut_cost.push_back(uniform(generator) * cut_scale * sct_cost);
+    }
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Telemetry: machine-readable records of the solution process written as JSON lines (one JSON object per line).
+ * Record types: "iteration" (column generation iteration of a node) and "node" (solved node of the B&B tree).
+ * Each record carries the run (instance and scenario) and the seconds since the telemetry file was opened.
+ * The run is kept per thread; workers of the tree search take the run of the thread that started them. */
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef vector<int> VecI;
+typedef vector<bool> VecB;
+typedef vector<double> VecD;
+typedef vector<string> VecS;
+//------------------------------------------------------------------------------------------------------------//
+struct Telemetry {
+    mutex Mutex; // protects file
+    ofstream File; // JSON lines file
+    atomic<bool> Enabled; // records are written
+    Time_point Start; // time the file was opened
+};
+//------------------------------------------------------------------------------------------------------------//
+struct Telemetry_record {
+    stringstream Fields; // JSON fields written so far
+};
+//------------------------------------------------------------------------------------------------------------//
+Telemetry &telemetry() {
+    static Telemetry log;
+    return log;
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Run (instance and scenario) of the calling thread. */
+string &telemetry_run() {
+    thread_local string run;
+    return run;
+}
+//------------------------------------------------------------------------------------------------------------//
+void open_telemetry(string filename) {
+    Telemetry &log(telemetry());
+    lock_guard<mutex> lock(log.Mutex);
+    log.File.open(filename, ios::trunc);
+    log.Enabled = log.File.is_open();
+    log.Start = wall_clock();
+    if (!log.Enabled)
+        cout << "WARNING: Telemetry file " << filename << " could not be opened!" << endl;
+}
+//------------------------------------------------------------------------------------------------------------//
+void close_telemetry() {
+    Telemetry &log(telemetry());
+    lock_guard<mutex> lock(log.Mutex);
+    log.Enabled = false;
+    if (log.File.is_open())
+        log.File.close();
+}
+//------------------------------------------------------------------------------------------------------------//
+bool telemetry_enabled() {
+    return telemetry().Enabled;
+}
+//------------------------------------------------------------------------------------------------------------//
+string json_string(const string &text) {
+    string quoted("\"");
+    for (auto it = text.begin(); it != text.end(); ++it) {
+        if ((*it) == '"' || (*it) == '\\')
+            quoted += '\\';
+        quoted += (*it);
+    }
+    return quoted + "\"";
+}
+//------------------------------------------------------------------------------------------------------------//
+template <typename T>
+void telemetry_field(Telemetry_record &record, const string &key, const T &value) {
+    record.Fields << "," << json_string(key) << ":" << value;
+}
+//------------------------------------------------------------------------------------------------------------//
+void telemetry_field(Telemetry_record &record, const string &key, const bool &value) {
+    record.Fields << "," << json_string(key) << ":" << (value ? "true" : "false");
+}
+//------------------------------------------------------------------------------------------------------------//
+void telemetry_field(Telemetry_record &record, const string &key, const string &value) {
+    record.Fields << "," << json_string(key) << ":" << json_string(value);
+}
+//------------------------------------------------------------------------------------------------------------//
+void telemetry_field(Telemetry_record &record, const string &key, const VecI &values) {
+    record.Fields << "," << json_string(key) << ":[";
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        record.Fields << (it == values.begin() ? "" : ",") << (*it);
+    }
+    record.Fields << "]";
+}
+//------------------------------------------------------------------------------------------------------------//
+void start_telemetry_record(Telemetry_record &record, string type) {
+    record.Fields << setprecision(10) << "{\"type\":" << json_string(type);
+    telemetry_field(record, "run", telemetry_run());
+    telemetry_field(record, "time", elapsed_seconds(telemetry().Start));
+}
+//------------------------------------------------------------------------------------------------------------//
+void write_telemetry_record(Telemetry_record &record) {
+    Telemetry &log(telemetry());
+    lock_guard<mutex> lock(log.Mutex);
+    if (log.Enabled)
+        log.File << record.Fields.str() << "}\n";
+}
+//------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,18 @@
+//------------------------------------------------------------------------------------------------------------//
+/* Wall-clock time measurement for time limits.
+ * clock() measures the CPU time of the process, which overstates the elapsed time once several threads work.*/
+//------------------------------------------------------------------------------------------------------------//
+using namespace std;
+//------------------------------------------------------------------------------------------------------------//
+// Type definitions
+typedef chrono::steady_clock::time_point Time_point;
+//------------------------------------------------------------------------------------------------------------//
+Time_point wall_clock() {
+    return chrono::steady_clock::now();
+}
+//------------------------------------------------------------------------------------------------------------//
+/* Elapsed wall-clock time since start in seconds. */
+double elapsed_seconds(Time_point &start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+//------------------------------------------------------------------------------------------------------------//